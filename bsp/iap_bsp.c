@@ -0,0 +1,97 @@
+/**
+ * @file    iap_bsp.c
+ * @brief   片内数据 Flash（IAP）底层驱动接口
+ * @version 1.0.0
+ * @author  ForeverMySunyu
+ * @date    2026-10-18
+ */
+
+#include "../core/stc89.h"
+#include "iap_bsp.h"
+
+/*==================== 内部函数声明区域 ====================*/
+
+static void IAP_Trigger(uint16_t addr, uint8_t cmd);
+static void IAP_Idle(void);
+
+/*==================== API 函数定义区域 ====================*/
+
+/**
+ * @brief 读取 1 字节
+ * @param addr Flash 地址
+ * @return 读取到的数据
+ */
+uint8_t IAP_ReadByte(uint16_t addr)
+{
+    uint8_t dat;
+
+    IAP_Trigger(addr, IAP_CMD_READ);
+    dat = ISP_DATA;
+    IAP_Idle();
+
+    return dat;
+}
+
+/**
+ * @brief 编程 1 字节
+ * @note 只能把 1 写成 0，目标字节应为擦除后的 0xFF（或只需清零某些位）
+ * @param addr Flash 地址
+ * @param dat 要写入的数据
+ * @return None
+ */
+void IAP_ProgramByte(uint16_t addr, uint8_t dat)
+{
+    ISP_DATA = dat;
+    IAP_Trigger(addr, IAP_CMD_PROGRAM);
+    IAP_Idle();
+}
+
+/**
+ * @brief 擦除 addr 所在的扇区（512 字节全部变为 0xFF）
+ * @param addr 扇区内任意地址
+ * @return None
+ */
+void IAP_EraseSector(uint16_t addr)
+{
+    IAP_Trigger(addr, IAP_CMD_ERASE);
+    IAP_Idle();
+}
+
+/*==================== 内部函数定义区域 ====================*/
+
+/**
+ * @brief 设置地址与命令并触发 IAP 操作，返回时操作已完成
+ * @note 0x46、0xB9 两次写入之间不能被中断打断，触发期间关闭总中断
+ * @param addr Flash 地址
+ * @param cmd IAP 命令
+ * @return None
+ */
+static void IAP_Trigger(uint16_t addr, uint8_t cmd)
+{
+    bit ea_save = EA;
+
+    ISP_CONTR = IAP_CONTR_ENABLE;
+    ISP_CMD = cmd;
+    ISP_ADDRH = (uint8_t)(addr >> 8);
+    ISP_ADDRL = (uint8_t)addr;
+
+    EA = 0;
+    ISP_TRIG = 0x46;
+    ISP_TRIG = 0xB9;
+    _nop_();
+    EA = ea_save;
+}
+
+/**
+ * @brief 回到空闲状态：关闭 IAP，清除命令与触发寄存器，地址指向 Flash 之外
+ * @param None
+ * @return None
+ */
+static void IAP_Idle(void)
+{
+    ISP_CONTR = 0;
+    ISP_CMD = IAP_CMD_IDLE;
+    ISP_TRIG = 0;
+    ISP_ADDRH = 0x80;
+    ISP_ADDRL = 0;
+}
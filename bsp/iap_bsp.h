@@ -0,0 +1,48 @@
+/**
+ * @file    iap_bsp.h
+ * @brief   片内数据 Flash（IAP）底层驱动接口
+ * @version 1.0.0
+ * @author  ForeverMySunyu
+ * @date    2026-10-18
+ *
+ * @details
+ *  - 通过 ISP_DATA/ISP_ADDRH/ISP_ADDRL/ISP_CMD/ISP_TRIG/ISP_CONTR 访问片内数据 Flash
+ *  - 每次操作：设置地址与命令，关闭总中断后向 ISP_TRIG 依次写入 0x46、0xB9 触发，CPU 暂停直到操作完成
+ *  - 操作完成后立即回到空闲状态（清除命令、地址指向 Flash 之外），防止误触发
+ *
+ * @attention 编程只能把 1 写成 0，把 0 恢复成 1 只能擦除整个扇区（512 字节，擦除后全为 0xFF）
+ */
+
+#ifndef _IAP_BSP_H_
+#define _IAP_BSP_H_
+
+#include "stdint.h"
+#include "../config/osc_configuration.h"
+
+/*==================== IAP 参数 ====================*/
+
+#define IAP_SECTOR_SIZE     512         //! 扇区大小（字节）
+
+#define IAP_CMD_IDLE        0x00        //! 空闲（无操作）
+#define IAP_CMD_READ        0x01        //! 字节读
+#define IAP_CMD_PROGRAM     0x02        //! 字节编程
+#define IAP_CMD_ERASE       0x03        //! 扇区擦除
+
+//! ISP_CONTR：ISPEN = 1，等待时间 WT2~WT0 按系统时钟选取
+#if (FOSC_HZ < 5000000UL)
+    #define IAP_CONTR_ENABLE    0x83
+#elif (FOSC_HZ < 10000000UL)
+    #define IAP_CONTR_ENABLE    0x82
+#elif (FOSC_HZ < 20000000UL)
+    #define IAP_CONTR_ENABLE    0x81
+#else
+    #define IAP_CONTR_ENABLE    0x80
+#endif
+
+/*==================== API 函数声明区域 ====================*/
+
+uint8_t IAP_ReadByte(uint16_t addr);                    //! 读取 1 字节
+void IAP_ProgramByte(uint16_t addr, uint8_t dat);       //! 编程 1 字节（只能把 1 写成 0）
+void IAP_EraseSector(uint16_t addr);                    //! 擦除 addr 所在的扇区
+
+#endif  /* _IAP_BSP_H_ */
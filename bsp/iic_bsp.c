@@ -2,9 +2,9 @@
  * @file    iic_bsp.c
  * @brief   IIC 底层驱动接口
  * @note GPIO 模拟，软件模拟
- * @version 1.0.0
+ * @version 1.1.0
  * @author  ForeverMySunyu
- * @date    2025-12-27
+ * @date    2026-10-18
  */
 
 
@@ -16,64 +16,29 @@
 
 /**
  * @brief IIC 初始化函数
+ * @note 释放所有已启用总线的 SCL 与 SDA（准双向口写 1 即为释放）
  * @param None
  * @return None
  */
 void IIC_Init_bsp(void)
 {
-    
-}
-
-/**
- * @brief 设置 SCL 电平
- * @param level 0-低电平，1-高电平
- * @return None
- */
-void SCL_Set(bool level)
-{
-    if (level)
-    {
-        IIC_SCL = 1;
-    }
-    else
-    {
-        IIC_SCL = 0;
-    }
-}
-
-/**
- * @brief 读取 SCL 电平
- * @param None
- * @retval 0-低电平，1-高电平
- */
-bool SCL_Read(void)
-{
-    return IIC_SCL;
-}
-
-/**
- * @brief 设置 SDA 电平
- * @param level 0-低电平，1-高电平
- * @return None
- */
-void SDA_Set(bool level)
-{
-    if (level)
-    {
-        IIC_SDA = 1;
-    }
-    else
-    {
-        IIC_SDA = 0;
-    }
-}
-
-/**
- * @brief 读取 SDA 电平
- * @param None
- * @retval 0-低电平，1-高电平
- */
-bool SDA_Read(void)
-{
-    return IIC_SDA;
+    #if IIC_BUS_NUM > 0
+        SDA_Set(0, 1);
+        SCL_Set(0, 1);
+    #endif
+
+    #if IIC_BUS_NUM > 1
+        SDA_Set(1, 1);
+        SCL_Set(1, 1);
+    #endif
+
+    #if IIC_BUS_NUM > 2
+        SDA_Set(2, 1);
+        SCL_Set(2, 1);
+    #endif
+
+    #if IIC_BUS_NUM > 3
+        SDA_Set(3, 1);
+        SCL_Set(3, 1);
+    #endif
 }
\ No newline at end of file
@@ -2,24 +2,73 @@
  * @file    iic_bsp.h
  * @brief   IIC 底层驱动接口
  * @note GPIO 模拟，软件模拟
- * @version 1.0.0
+ * @version 1.2.0
  * @author  ForeverMySunyu
- * @date    2025-12-27
+ * @date    2026-10-18
+ *
+ * @details
+ *  - 每条 IIC 总线的 SCL/SDA 引脚由 iic_configuration.h 中的总线表生成 sbit 定义
+ *  - GPIO 操作接口为宏，总线号必须是编译期常量，
+ *    展开后直接对固定引脚进行位操作（SETB/CLR/MOV C,bit），没有函数调用开销
+ *  - IIC_BSP_SIMULATION 为 1 时，GPIO 操作接口改为调用主机仿真总线模型（iic_sim_bsp.c）
  */
 
 #ifndef _IIC_BSP_H_
 #define _IIC_BSP_H_
 
 #include <stdbool.h>
+#include "../config/iic_configuration.h"
 
-/*==================== API 函数声明区域 ====================*/
+#if IIC_BSP_SIMULATION
+
+/*==================== GPIO 操作接口（主机仿真） ====================*/
+
+#include "iic_sim_bsp.h"
+
+#define SCL_Set(bus, level)     iic_sim_scl_set((bus), (level))         //! 设置 SCL 电平（0-低电平，1-高电平）
+#define SCL_Read(bus)           iic_sim_scl_read(bus)                   //! 读取 SCL 电平
+#define SDA_Set(bus, level)     iic_sim_sda_set((bus), (level))         //! 设置 SDA 电平（0-低电平，1-高电平）
+#define SDA_Read(bus)           iic_sim_sda_read(bus)                   //! 读取 SDA 电平
+
+#else
+
+/*==================== 引脚定义区域（由总线表生成） ====================*/
+
+#if IIC_BUS_NUM > 0
+    sbit    IIC0_SCL_PIN    =   IIC0_SCL;
+    sbit    IIC0_SDA_PIN    =   IIC0_SDA;
+#endif
+
+#if IIC_BUS_NUM > 1
+    sbit    IIC1_SCL_PIN    =   IIC1_SCL;
+    sbit    IIC1_SDA_PIN    =   IIC1_SDA;
+#endif
 
-void IIC_Init_bsp(void);            //! IIC 初始化
+#if IIC_BUS_NUM > 2
+    sbit    IIC2_SCL_PIN    =   IIC2_SCL;
+    sbit    IIC2_SDA_PIN    =   IIC2_SDA;
+#endif
+
+#if IIC_BUS_NUM > 3
+    sbit    IIC3_SCL_PIN    =   IIC3_SCL;
+    sbit    IIC3_SDA_PIN    =   IIC3_SDA;
+#endif
+
+/*==================== GPIO 操作接口（真实硬件） ====================*/
+
+//! 由总线号和线名拼接出引脚名，例如 IIC_BSP_PIN(0, SCL) -> IIC0_SCL_PIN
+#define IIC_BSP_PIN(bus, line)      IIC_BSP_PIN_(bus, line)
+#define IIC_BSP_PIN_(bus, line)     IIC##bus##_##line##_PIN
+
+#define SCL_Set(bus, level)     (IIC_BSP_PIN(bus, SCL) = (level))       //! 设置 SCL 电平（0-低电平，1-高电平）
+#define SCL_Read(bus)           (IIC_BSP_PIN(bus, SCL))                 //! 读取 SCL 电平
+#define SDA_Set(bus, level)     (IIC_BSP_PIN(bus, SDA) = (level))       //! 设置 SDA 电平（0-低电平，1-高电平）
+#define SDA_Read(bus)           (IIC_BSP_PIN(bus, SDA))                 //! 读取 SDA 电平
+
+#endif  /* IIC_BSP_SIMULATION */
+
+/*==================== API 函数声明区域 ====================*/
 
-//! GPIO 操作接口
-void SCL_Set(bool level);
-bool SCL_Read(void);
-void SDA_Set(bool level);
-bool SDA_Read(void);
+void IIC_Init_bsp(void);            //! IIC 初始化（释放所有总线的 SCL 与 SDA）
 
 #endif  /* _IIC_BSP_H_ */
\ No newline at end of file
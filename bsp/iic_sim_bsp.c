@@ -0,0 +1,641 @@
+/**
+ * @file    iic_sim_bsp.c
+ * @brief   IIC 主机仿真 bsp 实现（开漏总线模型 + AT24Cxx 行为模型）
+ * @version 1.0.0
+ * @author  ForeverMySunyu
+ * @date    2026-10-18
+ *
+ * @details
+ *  - 仅用于主机（PC）编译，不要加入 Keil 工程
+ *  - 每次主机操作引脚后重新计算线上电平，并把 START / STOP / SCL 边沿分发给总线上的从机模型
+ *  - 仿真时间单位为皮秒（ps），由 FOSC_HZ 与 MACHINE_CYCLE 换算机器周期
+ *  - 本文件同时提供 delay_10us() / delay_1ms() / delay_1s() 的仿真实现（只推进仿真时间），
+ *    主机编译时不要再编译 core/delay.c
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "../config/osc_configuration.h"
+#include "../config/iic_configuration.h"
+#include "../core/delay.h"
+#include "iic_sim_bsp.h"
+
+/*==================== 仿真时间换算 ====================*/
+
+#define IIC_SIM_CYCLE_PS        ((unsigned long long)MACHINE_CYCLE * 1000000000000ULL / FOSC_HZ)   //! 1 个机器周期（ps）
+#define IIC_SIM_US_PS           1000000ULL                                                          //! 1 us（ps）
+
+/*==================== 模型数据结构 ====================*/
+
+/** AT24Cxx 模型协议状态 */
+typedef enum
+{
+    AT24_IDLE = 0,          //! 等待 START
+    AT24_RX_DEV_ADDR,       //! 接收设备地址
+    AT24_RX_WORD_ADDR,      //! 接收字地址
+    AT24_RX_DATA,           //! 接收写入数据（页缓冲）
+    AT24_TX_DATA,           //! 发送读出数据
+    AT24_IGNORE             //! 未被选中 / 已 NACK，等待下一个 START 或 STOP
+} at24_state_t;
+
+/** AT24Cxx 模型 */
+typedef struct
+{
+    bool used;
+    uint8_t bus;
+    uint8_t dev_addr;               //! 8 位写地址
+    uint8_t block_mask;             //! 设备地址中作为块选择位（字地址高位）的掩码
+    uint32_t size;
+    uint16_t page_size;
+    uint8_t addr_bytes;
+    unsigned long long write_ps;    //! 写周期时间
+    unsigned long long stretch_ps;  //! 时钟延展时间
+    uint8_t *mem;                   //! 存储阵列
+
+    /* 协议状态 */
+    at24_state_t state;
+    uint8_t shift;                  //! 接收移位寄存器
+    uint8_t bit_cnt;                //! 当前字节已接收 / 已发送的位数
+    bool ack_phase;                 //! 处于第 9 个时钟（ACK 位）
+    bool ack_ok;                    //! 本字节是否回 ACK（接收时）/ 主机是否回 ACK（发送时）
+    uint8_t tx_byte;                //! 正在发送的字节
+    uint8_t addr_cnt;               //! 已接收的字地址字节数
+    uint32_t addr;                  //! 当前地址计数器
+    uint8_t page_buf[256];          //! 页写缓冲（数据）
+    uint8_t page_hit[256];          //! 页写缓冲（是否被写入）
+    uint16_t page_pending;          //! 页写缓冲中待写入的字节数
+    uint32_t page_base;             //! 页写的页起始地址
+    bool sda_low;                   //! 从机是否拉低 SDA
+    unsigned long long busy_until;  //! 写周期结束时间
+    unsigned long long stretch_until;   //! 时钟延展结束时间
+    uint32_t write_cycles;          //! 已执行的写周期次数
+} at24_model_t;
+
+/** 总线 */
+typedef struct
+{
+    bool m_scl;                     //! 主机 SCL 输出（1 为释放）
+    bool m_sda;                     //! 主机 SDA 输出（1 为释放）
+    bool scl;                       //! SCL 线上电平
+    bool sda;                       //! SDA 线上电平
+    uint16_t stuck_clocks;          //! 故障注入：SDA 被拉低的剩余时钟数（0xFFFF 为永久）
+    uint32_t scl_clocks;            //! SCL 上升沿计数
+    uint32_t violations;            //! 协议违例计数
+} sim_bus_t;
+
+/*==================== 静态变量 ====================*/
+
+static sim_bus_t sim_bus[IIC_BUS_NUM];
+static at24_model_t at24[IIC_SIM_AT24_MAX_NUM];
+static unsigned long long sim_now_ps = 0;       //! 当前仿真时间
+static unsigned long long sim_mark_ps = 0;      //! iic_sim_mark() 记录的时间
+static bool sim_ready = 0;
+
+/*==================== 内部函数声明区域 ====================*/
+
+static void sim_advance_cycles(uint16_t cycles);
+static void sim_update(uint8_t bus);
+static bool sim_resolve_scl(uint8_t bus);
+static bool sim_resolve_sda(uint8_t bus);
+static void at24_on_start(at24_model_t *dev);
+static void at24_on_stop(at24_model_t *dev);
+static void at24_on_scl_rise(at24_model_t *dev, bool sda);
+static void at24_on_scl_fall(at24_model_t *dev);
+static bool at24_on_byte(at24_model_t *dev, uint8_t byte);
+static void at24_load_tx(at24_model_t *dev);
+
+/*==================== GPIO 仿真接口 ====================*/
+
+/**
+ * @brief 主机设置 SCL
+ * @param bus 总线号
+ * @param level 0-拉低，1-释放
+ * @return None
+ */
+void iic_sim_scl_set(uint8_t bus, bool level)
+{
+    sim_advance_cycles(IIC_SIM_PIN_SET_CYCLES);
+
+    /* 主机在 SCL 仍被从机延展时再次拉低 SCL：这个时钟实际上没有产生 */
+    if (!level && sim_bus[bus].m_scl && !sim_bus[bus].scl)
+    {
+        sim_bus[bus].violations ++;
+    }
+
+    sim_bus[bus].m_scl = level ? 1 : 0;
+    sim_update(bus);
+}
+
+/**
+ * @brief 读取 SCL 线上电平
+ * @param bus 总线号
+ * @return SCL 电平
+ */
+bool iic_sim_scl_read(uint8_t bus)
+{
+    sim_advance_cycles(IIC_POLL_LOOP_CYCLES);
+    sim_update(bus);
+
+    return sim_bus[bus].scl;
+}
+
+/**
+ * @brief 主机设置 SDA
+ * @param bus 总线号
+ * @param level 0-拉低，1-释放
+ * @return None
+ */
+void iic_sim_sda_set(uint8_t bus, bool level)
+{
+    sim_advance_cycles(IIC_SIM_PIN_SET_CYCLES);
+
+    sim_bus[bus].m_sda = level ? 1 : 0;
+    sim_update(bus);
+}
+
+/**
+ * @brief 读取 SDA 线上电平
+ * @param bus 总线号
+ * @return SDA 电平
+ */
+bool iic_sim_sda_read(uint8_t bus)
+{
+    sim_advance_cycles(IIC_POLL_LOOP_CYCLES);
+    sim_update(bus);
+
+    return sim_bus[bus].sda;
+}
+
+/*==================== 仿真控制接口 ====================*/
+
+/**
+ * @brief 复位仿真器：卸下所有从机模型，总线释放，仿真时间清零
+ * @param None
+ * @return None
+ */
+void iic_sim_reset(void)
+{
+    uint8_t i;
+
+    for (i = 0; i < IIC_SIM_AT24_MAX_NUM; i++)
+    {
+        if (at24[i].used)   free(at24[i].mem);
+        memset(&at24[i], 0, sizeof(at24[i]));
+    }
+
+    for (i = 0; i < IIC_BUS_NUM; i++)
+    {
+        memset(&sim_bus[i], 0, sizeof(sim_bus[i]));
+        sim_bus[i].m_scl = 1;
+        sim_bus[i].m_sda = 1;
+        sim_bus[i].scl = 1;
+        sim_bus[i].sda = 1;
+    }
+
+    sim_now_ps = 0;
+    sim_mark_ps = 0;
+    sim_ready = 1;
+}
+
+/**
+ * @brief 在总线上挂接一个 AT24Cxx 模型
+ * @return 模型编号（>= 0），失败返回 -1
+ */
+int8_t iic_sim_attach_at24(uint8_t bus, uint8_t dev_addr, uint32_t size, uint16_t page_size,
+                           uint8_t addr_bytes, uint16_t write_time_us, uint16_t stretch_us)
+{
+    int8_t i;
+    uint32_t blocks;
+
+    if (!sim_ready)     iic_sim_reset();
+
+    if ((bus >= IIC_BUS_NUM) || (page_size == 0) || (page_size > 256) || (page_size & (page_size - 1)))
+    {
+        return -1;
+    }
+
+    for (i = 0; i < IIC_SIM_AT24_MAX_NUM; i++)
+    {
+        if (!at24[i].used)  break;
+    }
+    if (i >= IIC_SIM_AT24_MAX_NUM)  return -1;
+
+    memset(&at24[i], 0, sizeof(at24[i]));
+    at24[i].mem = (uint8_t *)malloc(size);
+    if (at24[i].mem == NULL)    return -1;
+    memset(at24[i].mem, 0xFF, size);
+
+    /* 字地址寻址范围以外的容量，由设备地址中的块选择位（A2 A1 A0 位置）补足 */
+    blocks = size >> (8 * addr_bytes);
+    at24[i].block_mask = (blocks > 1) ? (uint8_t)(((blocks - 1) << 1) & 0x0E) : 0;
+
+    at24[i].used = 1;
+    at24[i].bus = bus;
+    at24[i].dev_addr = dev_addr & 0xFE;
+    at24[i].size = size;
+    at24[i].page_size = page_size;
+    at24[i].addr_bytes = addr_bytes;
+    at24[i].write_ps = (unsigned long long)write_time_us * IIC_SIM_US_PS;
+    at24[i].stretch_ps = (unsigned long long)stretch_us * IIC_SIM_US_PS;
+    at24[i].state = AT24_IDLE;
+
+    return i;
+}
+
+/**
+ * @brief 获取 AT24Cxx 模型的存储阵列
+ * @param dev 模型编号
+ * @return 指向存储阵列的指针，编号无效时返回 NULL
+ */
+uint8_t *iic_sim_at24_memory(int8_t dev)
+{
+    if ((dev < 0) || (dev >= IIC_SIM_AT24_MAX_NUM) || !at24[dev].used)     return NULL;
+
+    return at24[dev].mem;
+}
+
+/**
+ * @brief 获取 AT24Cxx 模型已执行的内部写周期次数
+ * @param dev 模型编号
+ * @return 写周期次数
+ */
+uint32_t iic_sim_at24_write_cycles(int8_t dev)
+{
+    if ((dev < 0) || (dev >= IIC_SIM_AT24_MAX_NUM) || !at24[dev].used)     return 0;
+
+    return at24[dev].write_cycles;
+}
+
+/**
+ * @brief 故障注入：让 SDA 被“从机”拉低，直到出现 clocks 个 SCL 上升沿
+ * @param bus 总线号
+ * @param clocks SCL 上升沿个数，0xFFFF 表示永久拉低，0 表示取消
+ * @return None
+ */
+void iic_sim_inject_sda_stuck(uint8_t bus, uint16_t clocks)
+{
+    sim_bus[bus].stuck_clocks = clocks;
+    sim_update(bus);
+}
+
+/**
+ * @brief 记录当前仿真时间，作为 iic_sim_elapsed_us() 的起点
+ */
+void iic_sim_mark(void)
+{
+    sim_mark_ps = sim_now_ps;
+}
+
+/**
+ * @brief 获取自上次 iic_sim_mark() 以来经过的仿真时间（us）
+ */
+uint32_t iic_sim_elapsed_us(void)
+{
+    return (uint32_t)((sim_now_ps - sim_mark_ps) / IIC_SIM_US_PS);
+}
+
+/**
+ * @brief 获取总线自复位以来的 SCL 上升沿个数
+ */
+uint32_t iic_sim_scl_clocks(uint8_t bus)
+{
+    return sim_bus[bus].scl_clocks;
+}
+
+/**
+ * @brief 获取协议违例次数
+ */
+uint32_t iic_sim_violations(uint8_t bus)
+{
+    return sim_bus[bus].violations;
+}
+
+/*==================== 延时函数仿真实现 ====================*/
+
+void delay_10us(uint8_t count)
+{
+    sim_now_ps += (unsigned long long)count * 10 * IIC_SIM_US_PS;
+}
+
+void delay_1ms(uint16_t count)
+{
+    sim_now_ps += (unsigned long long)count * 1000 * IIC_SIM_US_PS;
+}
+
+void delay_1s(uint16_t count)
+{
+    sim_now_ps += (unsigned long long)count * 1000000 * IIC_SIM_US_PS;
+}
+
+/*==================== 内部函数定义区域 ====================*/
+
+/**
+ * @brief 推进仿真时间
+ * @param cycles 机器周期数
+ */
+static void sim_advance_cycles(uint16_t cycles)
+{
+    if (!sim_ready)     iic_sim_reset();
+
+    sim_now_ps += (unsigned long long)cycles * IIC_SIM_CYCLE_PS;
+}
+
+/**
+ * @brief 计算 SCL 线上电平（主机与所有从机线与）
+ */
+static bool sim_resolve_scl(uint8_t bus)
+{
+    uint8_t i;
+
+    if (!sim_bus[bus].m_scl)    return 0;
+
+    for (i = 0; i < IIC_SIM_AT24_MAX_NUM; i++)
+    {
+        if (at24[i].used && (at24[i].bus == bus) && (sim_now_ps < at24[i].stretch_until))   return 0;
+    }
+
+    return 1;
+}
+
+/**
+ * @brief 计算 SDA 线上电平（主机、所有从机与故障注入线与）
+ */
+static bool sim_resolve_sda(uint8_t bus)
+{
+    uint8_t i;
+
+    if (!sim_bus[bus].m_sda || sim_bus[bus].stuck_clocks)   return 0;
+
+    for (i = 0; i < IIC_SIM_AT24_MAX_NUM; i++)
+    {
+        if (at24[i].used && (at24[i].bus == bus) && at24[i].sda_low)    return 0;
+    }
+
+    return 1;
+}
+
+/**
+ * @brief 重新计算线上电平，检测 START / STOP / SCL 边沿并分发给从机模型
+ * @param bus 总线号
+ */
+static void sim_update(uint8_t bus)
+{
+    sim_bus_t *b = &sim_bus[bus];
+    bool scl = sim_resolve_scl(bus);
+    bool sda = sim_resolve_sda(bus);
+    uint8_t i;
+
+    /* SCL 保持高电平期间 SDA 变化：START / STOP */
+    if (b->scl && scl && (b->sda != sda))
+    {
+        for (i = 0; i < IIC_SIM_AT24_MAX_NUM; i++)
+        {
+            if (!at24[i].used || (at24[i].bus != bus))  continue;
+
+            if (!sda)   at24_on_start(&at24[i]);
+            else        at24_on_stop(&at24[i]);
+        }
+    }
+
+    /* SCL 上升沿：从机采样 */
+    if (!b->scl && scl)
+    {
+        b->scl_clocks ++;
+
+        if (b->stuck_clocks && (b->stuck_clocks != 0xFFFF))    b->stuck_clocks --;
+
+        for (i = 0; i < IIC_SIM_AT24_MAX_NUM; i++)
+        {
+            if (at24[i].used && (at24[i].bus == bus))   at24_on_scl_rise(&at24[i], sda);
+        }
+    }
+
+    /* SCL 下降沿：从机更新输出 */
+    if (b->scl && !scl)
+    {
+        for (i = 0; i < IIC_SIM_AT24_MAX_NUM; i++)
+        {
+            if (at24[i].used && (at24[i].bus == bus))   at24_on_scl_fall(&at24[i]);
+        }
+    }
+
+    /* 从机输出在 SCL 为低时改变，只更新电平，不再产生边沿事件 */
+    b->scl = sim_resolve_scl(bus);
+    b->sda = sim_resolve_sda(bus);
+}
+
+/**
+ * @brief START（含重复 START）
+ */
+static void at24_on_start(at24_model_t *dev)
+{
+    /* 页写数据尚未以 STOP 结束就出现 START：AT24Cxx 放弃本次写入 */
+    dev->page_pending = 0;
+
+    dev->sda_low = 0;
+    dev->ack_phase = 0;
+    dev->bit_cnt = 0;
+    dev->shift = 0;
+
+    /* 写周期期间同样接收设备地址，在 ACK 位回 NACK（见 at24_on_byte） */
+    dev->state = AT24_RX_DEV_ADDR;
+}
+
+/**
+ * @brief STOP：若页缓冲中有数据，启动内部写周期
+ */
+static void at24_on_stop(at24_model_t *dev)
+{
+    uint16_t i;
+
+    if ((dev->state == AT24_RX_DATA) && dev->page_pending)
+    {
+        for (i = 0; i < dev->page_size; i++)
+        {
+            if (dev->page_hit[i])   dev->mem[dev->page_base + i] = dev->page_buf[i];
+        }
+
+        dev->busy_until = sim_now_ps + dev->write_ps;
+        dev->write_cycles ++;
+    }
+
+    dev->page_pending = 0;
+    dev->sda_low = 0;
+    dev->ack_phase = 0;
+    dev->state = AT24_IDLE;
+}
+
+/**
+ * @brief SCL 上升沿：接收时采样数据位，发送时在 ACK 位采样主机应答
+ */
+static void at24_on_scl_rise(at24_model_t *dev, bool sda)
+{
+    switch (dev->state)
+    {
+        case AT24_RX_DEV_ADDR:
+        case AT24_RX_WORD_ADDR:
+        case AT24_RX_DATA:
+            if (!dev->ack_phase && (dev->bit_cnt < 8))
+            {
+                dev->shift = (uint8_t)((dev->shift << 1) | (sda ? 1 : 0));
+                dev->bit_cnt ++;
+            }
+            break;
+
+        case AT24_TX_DATA:
+            if (dev->ack_phase)
+            {
+                dev->ack_ok = !sda;     //! 主机 ACK 为低电平
+            }
+            break;
+
+        default:
+            break;
+    }
+}
+
+/**
+ * @brief SCL 下降沿：进入 / 结束 ACK 位，或输出下一个数据位
+ */
+static void at24_on_scl_fall(at24_model_t *dev)
+{
+    switch (dev->state)
+    {
+        case AT24_RX_DEV_ADDR:
+        case AT24_RX_WORD_ADDR:
+        case AT24_RX_DATA:
+            if (!dev->ack_phase && (dev->bit_cnt == 8))
+            {
+                /* 8 位接收完成，进入 ACK 位 */
+                dev->ack_ok = at24_on_byte(dev, dev->shift);
+                dev->sda_low = dev->ack_ok;
+                dev->ack_phase = 1;
+
+                if (dev->ack_ok && dev->stretch_ps)     dev->stretch_until = sim_now_ps + dev->stretch_ps;
+            }
+            else if (dev->ack_phase)
+            {
+                /* ACK 位结束 */
+                dev->sda_low = 0;
+                dev->ack_phase = 0;
+                dev->bit_cnt = 0;
+                dev->shift = 0;
+
+                if (!dev->ack_ok)
+                {
+                    dev->state = AT24_IGNORE;
+                }
+                else if (dev->state == AT24_TX_DATA)
+                {
+                    at24_load_tx(dev);      //! 读地址已应答，开始输出第 1 个字节
+                }
+            }
+            break;
+
+        case AT24_TX_DATA:
+            if (dev->ack_phase)
+            {
+                dev->ack_phase = 0;
+
+                if (dev->ack_ok)    at24_load_tx(dev);      //! 主机 ACK：继续输出下一个字节
+                else                dev->state = AT24_IGNORE;
+            }
+            else if (dev->bit_cnt < 8)
+            {
+                dev->sda_low = !((dev->tx_byte >> (7 - dev->bit_cnt)) & 0x01);
+                dev->bit_cnt ++;
+            }
+            else
+            {
+                dev->sda_low = 0;       //! 释放 SDA，等待主机 ACK
+                dev->ack_phase = 1;
+            }
+            break;
+
+        default:
+            break;
+    }
+}
+
+/**
+ * @brief 处理接收到的 1 个字节
+ * @return 是否回 ACK
+ */
+static bool at24_on_byte(at24_model_t *dev, uint8_t byte)
+{
+    uint32_t offset;
+
+    switch (dev->state)
+    {
+        case AT24_RX_DEV_ADDR:
+            if ((byte & 0xF0 & ~dev->block_mask) != (dev->dev_addr & 0xF0 & ~dev->block_mask))     return 0;
+            if ((byte & 0x0E & ~dev->block_mask) != (dev->dev_addr & 0x0E & ~dev->block_mask))     return 0;
+
+            /* 写周期期间不应答 */
+            if (sim_now_ps < dev->busy_until)   return 0;
+
+            /* 块选择位作为字地址高位 */
+            if (dev->block_mask)
+            {
+                dev->addr = (dev->addr & ((1UL << (8 * dev->addr_bytes)) - 1))
+                          | ((uint32_t)((byte & dev->block_mask) >> 1) << (8 * dev->addr_bytes));
+            }
+
+            if (byte & 0x01)
+            {
+                dev->state = AT24_TX_DATA;
+            }
+            else
+            {
+                dev->state = AT24_RX_WORD_ADDR;
+                dev->addr_cnt = 0;
+            }
+            return 1;
+
+        case AT24_RX_WORD_ADDR:
+            if (dev->addr_cnt == 0)
+            {
+                /* 保留块选择位给出的高位 */
+                dev->addr &= ~((1UL << (8 * dev->addr_bytes)) - 1);
+            }
+            dev->addr |= (uint32_t)byte << (8 * (dev->addr_bytes - 1 - dev->addr_cnt));
+            dev->addr %= dev->size;
+            dev->addr_cnt ++;
+
+            if (dev->addr_cnt >= dev->addr_bytes)
+            {
+                dev->state = AT24_RX_DATA;
+                dev->page_base = dev->addr & ~(uint32_t)(dev->page_size - 1);
+                dev->page_pending = 0;
+                memset(dev->page_hit, 0, sizeof(dev->page_hit));
+            }
+            return 1;
+
+        case AT24_RX_DATA:
+            /* 页内回卷 */
+            offset = dev->addr & (dev->page_size - 1);
+            dev->page_buf[offset] = byte;
+            if (!dev->page_hit[offset])
+            {
+                dev->page_hit[offset] = 1;
+                dev->page_pending ++;
+            }
+            dev->addr = dev->page_base | ((offset + 1) & (dev->page_size - 1));
+            return 1;
+
+        default:
+            return 0;
+    }
+}
+
+/**
+ * @brief 读出当前地址的字节并输出最高位，地址计数器加 1（整片回卷）
+ */
+static void at24_load_tx(at24_model_t *dev)
+{
+    dev->tx_byte = dev->mem[dev->addr];
+    dev->addr = (dev->addr + 1) % dev->size;
+
+    dev->sda_low = !((dev->tx_byte >> 7) & 0x01);
+    dev->bit_cnt = 1;
+}
\ No newline at end of file
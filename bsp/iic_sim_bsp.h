@@ -0,0 +1,123 @@
+/**
+ * @file    iic_sim_bsp.h
+ * @brief   IIC 主机仿真 bsp 接口（开漏总线模型 + AT24Cxx 行为模型）
+ * @version 1.0.0
+ * @author  ForeverMySunyu
+ * @date    2026-10-18
+ *
+ * @details
+ *  - 仅在 IIC_BSP_SIMULATION 为 1 时使用，用于在 PC 上检查 iic_hal.c / eeprom_hal.c 的协议与时序
+ *  - 总线为开漏“线与”模型：主机与所有从机任一方拉低，线上即为低电平
+ *  - AT24Cxx 模型支持：1/2 字节字地址、设备地址中的块选择位、页写回卷、顺序读、
+ *    写周期期间对设备地址回 NACK（ACK 轮询）、ACK 前的时钟延展
+ *  - 仿真时间按机器周期推进：引脚写 IIC_SIM_PIN_SET_CYCLES 个周期，引脚读（轮询循环一次）
+ *    IIC_POLL_LOOP_CYCLES 个周期，delay_10us()/delay_1ms() 按名义时间推进
+ *
+ * @note 主机编译示例（在工程根目录执行）：
+ * @code
+ * gcc -DIIC_BSP_SIMULATION=1 -Dcode= -Dxdata= -Ddata= -Didata= \
+ *     hal/iic_hal.c hal/eeprom_hal.c bsp/iic_bsp.c bsp/iic_sim_bsp.c my_check.c -o iic_check
+ * @endcode
+ *
+ * @code{.c}
+ * // 用法示例：测量一次页写的总线时间
+ * iic_sim_reset();
+ * iic_sim_attach_at24(0, 0xA0, 256, 8, 1, 5000, 0);    // AT24C02，写周期 5ms，无时钟延展
+ * iic_sim_mark();
+ * EEPROM_PageWrite(0, 0, buf, 8);
+ * if (iic_sim_elapsed_us() > 6500)  { ...速度回退... }
+ * @endcode
+ */
+
+#ifndef _IIC_SIM_BSP_H_
+#define _IIC_SIM_BSP_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*==================== 仿真参数配置 ====================*/
+
+#define IIC_SIM_AT24_MAX_NUM        4           //! 可挂接的 AT24Cxx 模型数量上限
+#define IIC_SIM_PIN_SET_CYCLES      2           //! 一次引脚写消耗的机器周期数（估算值）
+
+/*==================== GPIO 仿真接口（供 iic_bsp.h 中的宏调用） ====================*/
+
+void iic_sim_scl_set(uint8_t bus, bool level);      //! 主机设置 SCL（1 为释放）
+bool iic_sim_scl_read(uint8_t bus);                 //! 读取 SCL 线上电平
+void iic_sim_sda_set(uint8_t bus, bool level);      //! 主机设置 SDA（1 为释放）
+bool iic_sim_sda_read(uint8_t bus);                 //! 读取 SDA 线上电平
+
+/*==================== 仿真控制接口 ====================*/
+
+/**
+ * @brief 复位仿真器：卸下所有从机模型，总线释放，仿真时间清零
+ * @param None
+ * @return None
+ */
+void iic_sim_reset(void);
+
+/**
+ * @brief 在总线上挂接一个 AT24Cxx 模型
+ * @param bus 总线号
+ * @param dev_addr 设备地址（8 位写地址，例如 0xA0；块选择位必须为 0）
+ * @param size 容量（字节）
+ * @param page_size 页大小（字节，2 的幂）
+ * @param addr_bytes 字地址字节数（1 或 2）
+ * @param write_time_us 内部写周期时间（us），期间设备对地址回 NACK
+ * @param stretch_us 每个 ACK 位之前拉低 SCL 的时间（us），0 表示不延展
+ * @return 模型编号（>= 0），失败返回 -1
+ */
+int8_t iic_sim_attach_at24(uint8_t bus, uint8_t dev_addr, uint32_t size, uint16_t page_size,
+                           uint8_t addr_bytes, uint16_t write_time_us, uint16_t stretch_us);
+
+/**
+ * @brief 获取 AT24Cxx 模型的存储阵列（可直接预置或检查内容）
+ * @param dev 模型编号
+ * @return 指向存储阵列的指针，编号无效时返回 NULL
+ */
+uint8_t *iic_sim_at24_memory(int8_t dev);
+
+/**
+ * @brief 获取 AT24Cxx 模型已执行的内部写周期次数
+ * @param dev 模型编号
+ * @return 写周期次数
+ */
+uint32_t iic_sim_at24_write_cycles(int8_t dev);
+
+/**
+ * @brief 故障注入：让 SDA 被“从机”拉低，直到出现 clocks 个 SCL 上升沿
+ * @param bus 总线号
+ * @param clocks SCL 上升沿个数，0xFFFF 表示永久拉低，0 表示取消
+ * @return None
+ */
+void iic_sim_inject_sda_stuck(uint8_t bus, uint16_t clocks);
+
+/**
+ * @brief 记录当前仿真时间，作为 iic_sim_elapsed_us() 的起点
+ * @param None
+ * @return None
+ */
+void iic_sim_mark(void);
+
+/**
+ * @brief 获取自上次 iic_sim_mark() 以来经过的仿真时间
+ * @param None
+ * @return 经过的时间（us）
+ */
+uint32_t iic_sim_elapsed_us(void);
+
+/**
+ * @brief 获取总线自复位以来的 SCL 上升沿个数（时钟数）
+ * @param bus 总线号
+ * @return SCL 上升沿个数
+ */
+uint32_t iic_sim_scl_clocks(uint8_t bus);
+
+/**
+ * @brief 获取协议违例次数（例如主机在从机延展时钟期间改变 SDA）
+ * @param bus 总线号
+ * @return 违例次数
+ */
+uint32_t iic_sim_violations(uint8_t bus);
+
+#endif  /* _IIC_SIM_BSP_H_ */
\ No newline at end of file
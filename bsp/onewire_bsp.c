@@ -0,0 +1,24 @@
+/**
+ * @file    onewire_bsp.c
+ * @brief   1-Wire 底层驱动接口
+ * @note GPIO 模拟，软件模拟
+ * @version 1.0.0
+ * @author  ForeverMySunyu
+ * @date    2026-10-18
+ */
+
+#include "../config/onewire_configuration.h"
+#include "onewire_bsp.h"
+
+/*==================== API 函数定义区域 ====================*/
+
+/**
+ * @brief 1-Wire 初始化函数
+ * @note 释放 DQ（准双向口写 1 即为释放，由外部上拉电阻拉高）
+ * @param None
+ * @return None
+ */
+void OneWire_Init_bsp(void)
+{
+    DQ_Set(1);
+}
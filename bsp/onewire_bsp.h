@@ -0,0 +1,32 @@
+/**
+ * @file    onewire_bsp.h
+ * @brief   1-Wire 底层驱动接口
+ * @note GPIO 模拟，软件模拟
+ * @version 1.0.0
+ * @author  ForeverMySunyu
+ * @date    2026-10-18
+ *
+ * @details
+ *  - GPIO 操作接口为宏，展开后为单条位操作指令（SETB/CLR/MOV C,bit），时隙内的机器周期数可精确计算
+ */
+
+#ifndef _ONEWIRE_BSP_H_
+#define _ONEWIRE_BSP_H_
+
+#include <stdbool.h>
+#include "../config/onewire_configuration.h"
+
+/*==================== 引脚定义区域 ====================*/
+
+sbit    ONEWIRE_DQ_PIN  =   ONEWIRE_DQ;
+
+/*==================== GPIO 操作接口 ====================*/
+
+#define DQ_Set(level)       (ONEWIRE_DQ_PIN = (level))      //! 设置 DQ 电平（0-拉低，1-释放）
+#define DQ_Read()           (ONEWIRE_DQ_PIN)                //! 读取 DQ 电平
+
+/*==================== API 函数声明区域 ====================*/
+
+void OneWire_Init_bsp(void);        //! 1-Wire 初始化（释放 DQ）
+
+#endif  /* _ONEWIRE_BSP_H_ */
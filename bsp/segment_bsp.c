@@ -1,14 +1,15 @@
 /**
  * @file    segment_bsp.C
  * @brief   数码管显示模块的 bsp 驱动源文件
- * @version 1.0.0
+ * @version 1.5.0
  * @author  ForeverMySunyu
- * @date    2025-12-19
+ * @date    2026-10-18
  *
  * @details 本文件用于数码管显示模块的板级驱动
  */
 
 #include "../config/segment_configuration.h"
+#include "../core/timer.h"
 #include "segment_bsp.h"
 
 
@@ -17,9 +18,9 @@
 #if (SEG_TYPE == SEG_COMMON_ANODE)
 
     /** 
-     * @brief 共阳极数码管段码查找表
+     * @brief 共阳极数码管段码查找表（段码端口 bit7~bit0 依次为 a~g、dp，低电平点亮）
      * @details 
-     * |         表位置         |    表值   | 显示的数字 |
+     * |         表位置         |    表值   | 显示的字符 |
      * | :--------------------: | :------: | :--------: |
      * | segment_code_table[0]  |   0x03   |     0      |
      * | segment_code_table[1]  |   0x9f   |     1      |
@@ -31,71 +32,122 @@
      * | segment_code_table[7]  |   0x1f   |     7      |
      * | segment_code_table[8]  |   0x01   |     8      |
      * | segment_code_table[9]  |   0x09   |     9      |
-     * | segment_code_table[10] |   0x02   |     0.     |
-     * | segment_code_table[11] |   0x9e   |     1.     |
-     * | segment_code_table[12] |   0x24   |     2.     |
-     * | segment_code_table[13] |   0x0c   |     3.     |
-     * | segment_code_table[14] |   0x98   |     4.     |
-     * | segment_code_table[15] |   0x48   |     5.     |
-     * | segment_code_table[16] |   0x40   |     6.     |
-     * | segment_code_table[17] |   0x14   |     7.     |
-     * | segment_code_table[18] |   0x00   |     8.     |
-     * | segment_code_table[19] |   0x08   |     9.     |
-     * | segment_code_table[20] |   0xfd   |     -      |
-     * | segment_code_table[21] |   0xff   |    全灭    |
-     * | segment_code_table[22] |   0x00   |    全亮    |
+     * | segment_code_table[10] |   0xfd   |     -      |
+     * | segment_code_table[11] |   0xff   |    全灭    |
+     * | segment_code_table[12] |   0x00   |    全亮    |
+     *
+     * @note 带小数点的段码由 SEG_CODE_DP() 在设置显示内容时合成
      */
-    static const uint8_t segment_code_table[22] = 
+    uint8_t code segment_code_table[13] = 
     {
         0x03, 0x9f, 0x25, 0x0d, 0x99,   //! 0 1 2 3 4
         0x49, 0x41, 0x1f, 0x01, 0x09,   //! 5 6 7 8 9
-        0x02, 0x9e, 0x24, 0x0c, 0x98,   //! 0. 1. 2. 3. 4.
-        0x48, 0x40, 0x14, 0x00, 0x08,   //! 5. 6. 7. 8. 9.
         0xfd, 0xff, 0x00                //! - 全灭 全亮
     };
 
 #elif (SEG_TYPE == SEG_COMMON_CATHODE)
 
     /** 
-     * @brief 共阴极数码管段码查找表
+     * @brief 共阴极数码管段码查找表（段码端口 bit7~bit0 依次为 a~g、dp，高电平点亮）
      * @details 
-     * |         表位置         |    表值   | 显示的数字 |
+     * |         表位置         |    表值   | 显示的字符 |
      * | :--------------------: | :------: | :--------: |
      * | segment_code_table[0]  |   0xfc   |     0      |
      * | segment_code_table[1]  |   0x60   |     1      |
      * | segment_code_table[2]  |   0xda   |     2      |
      * | segment_code_table[3]  |   0xf2   |     3      |
      * | segment_code_table[4]  |   0x66   |     4      |
-     * | segment_code_table[5]  |   0x9e   |     5      |
+     * | segment_code_table[5]  |   0xb6   |     5      |
      * | segment_code_table[6]  |   0xbe   |     6      |
      * | segment_code_table[7]  |   0xe0   |     7      |
      * | segment_code_table[8]  |   0xfe   |     8      |
      * | segment_code_table[9]  |   0xf6   |     9      |
-     * | segment_code_table[10] |   0xfd   |     0.     |
-     * | segment_code_table[11] |   0x61   |     1.     |
-     * | segment_code_table[12] |   0xdb   |     2.     |
-     * | segment_code_table[13] |   0xf3   |     3.     |
-     * | segment_code_table[14] |   0x67   |     4.     |
-     * | segment_code_table[15] |   0x9f   |     5.     |
-     * | segment_code_table[16] |   0xbf   |     6.     |
-     * | segment_code_table[17] |   0xe1   |     7.     |
-     * | segment_code_table[18] |   0xff   |     8.     |
-     * | segment_code_table[19] |   0xf7   |     9.     |
-     * | segment_code_table[20] |   0x02   |     -      |
-     * | segment_code_table[21] |   0x00   |    全灭    |
-     * | segment_code_table[22] |   0xff   |    全亮    |
+     * | segment_code_table[10] |   0x02   |     -      |
+     * | segment_code_table[11] |   0x00   |    全灭    |
+     * | segment_code_table[12] |   0xff   |    全亮    |
+     *
+     * @note 带小数点的段码由 SEG_CODE_DP() 在设置显示内容时合成
      */
-    static uint8_t code segment_code_table[22] = 
+    uint8_t code segment_code_table[13] = 
     {
-        0xfc, 0x60, 0xda, 0xf2,0x66,    //! 0 1 2 3 4
-        0x9e, 0xbe, 0xe0,0xfe, 0xf6,    //! 5 6 7 8 9
-        0xfd, 0x61,0xdb, 0xf3, 0x67,    //! 0. 1. 2. 3. 4.
-        0x9f,0xbf, 0xe1, 0xff, 0xf7,    //! 5. 6. 7. 8. 9.
+        0xfc, 0x60, 0xda, 0xf2, 0x66,   //! 0 1 2 3 4
+        0xb6, 0xbe, 0xe0, 0xfe, 0xf6,   //! 5 6 7 8 9
         0x02, 0x00, 0xff                //! - 全灭 全亮
     };
 
 #endif
 
+/**
+ * @brief ASCII 字形表（0x20 ~ 0x7f），bit7~bit0 依次为 a~g、dp，置 1 的段点亮（与数码管类型无关）
+ * @note 由 SEG_GLYPH_BYTE() 转换为段码端口字节；七段无法区分的字符共用字形（如 '5' 与 'S'、'0' 与 'O'），
+ *       M、W 等字符只能近似显示
+ */
+uint8_t code segment_glyph_table[96] = 
+{
+    0x00, 0x61, 0x44, 0x7e, 0xb6, 0x4b, 0x62, 0x04,   //! SP ! " # $ % & '
+    0x94, 0xd0, 0x84, 0x0e, 0x08, 0x02, 0x01, 0x4a,   //! ( ) * + , - . /
+    0xfc, 0x60, 0xda, 0xf2, 0x66, 0xb6, 0xbe, 0xe0,   //! 0 1 2 3 4 5 6 7
+    0xfe, 0xf6, 0x90, 0xb0, 0x86, 0x12, 0xc2, 0xcb,   //! 8 9 : ; < = > ?
+    0xfa, 0xee, 0x3e, 0x9c, 0x7a, 0x9e, 0x8e, 0xbc,   //! @ A B C D E F G
+    0x6e, 0x0c, 0x78, 0xae, 0x1c, 0xa8, 0xec, 0xfc,   //! H I J K L M N O
+    0xce, 0xd6, 0xcc, 0xb6, 0x1e, 0x7c, 0x7c, 0x54,   //! P Q R S T U V W
+    0x6e, 0x76, 0xda, 0x9c, 0x26, 0xf0, 0xc4, 0x10,   //! X Y Z [ \ ] ^ _
+    0x40, 0xfa, 0x3e, 0x1a, 0x7a, 0xde, 0x8e, 0xf6,   //! ` a b c d e f g
+    0x2e, 0x08, 0x30, 0xae, 0x0c, 0x28, 0x2a, 0x3a,   //! h i j k l m n o
+    0xce, 0xe6, 0x0a, 0xb6, 0x1e, 0x38, 0x38, 0x28,   //! p q r s t u v w
+    0x6e, 0x76, 0xda, 0x62, 0x0c, 0x0e, 0x80, 0x00,   //! x y z { | } ~ DEL
+};
+
+#if (SEG_DRIVER == SEG_DRIVER_74HC138) && ((SEG_138_SHIFT < 0) || (SEG_138_SHIFT > 5))
+    #error "SEG_138_SHIFT must be between 0 and 5"
+#endif
+
+/**
+ * @brief 位选查找表：第 i 位对应的位选端口字节
+ * @note 使用 38 译码器时为译码器输入（位号，已左移 SEG_138_SHIFT 位，只占 SEG_138_MASK 中的位），
+ *       否则（直接驱动、74HC595）按数码管类型为单个有效位
+ */
+#if (SEG_DRIVER == SEG_DRIVER_74HC138)
+    uint8_t code segment_digit_table[8] =
+    {
+        0 << SEG_138_SHIFT, 1 << SEG_138_SHIFT, 2 << SEG_138_SHIFT, 3 << SEG_138_SHIFT,
+        4 << SEG_138_SHIFT, 5 << SEG_138_SHIFT, 6 << SEG_138_SHIFT, 7 << SEG_138_SHIFT
+    };
+#elif (SEG_TYPE == SEG_COMMON_ANODE)
+    uint8_t code segment_digit_table[8] = {0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80};
+#elif (SEG_TYPE == SEG_COMMON_CATHODE)
+    uint8_t code segment_digit_table[8] = {0xfe, 0xfd, 0xfb, 0xf7, 0xef, 0xdf, 0xbf, 0x7f};
+#endif
+
+
+
+#if (SEG_DRIVER == SEG_DRIVER_74HC595)
+
+/* ================== 74HC595 移位寄存器（可位寻址） ================== */
+
+uint8_t bdata seg_595_shift;        //! 待移出的字节
+
+sbit    SEG_595_SHIFT_7     =   seg_595_shift^7;
+sbit    SEG_595_SHIFT_6     =   seg_595_shift^6;
+sbit    SEG_595_SHIFT_5     =   seg_595_shift^5;
+sbit    SEG_595_SHIFT_4     =   seg_595_shift^4;
+sbit    SEG_595_SHIFT_3     =   seg_595_shift^3;
+sbit    SEG_595_SHIFT_2     =   seg_595_shift^2;
+sbit    SEG_595_SHIFT_1     =   seg_595_shift^1;
+sbit    SEG_595_SHIFT_0     =   seg_595_shift^0;
+
+//! 移出 1 位：MOV C,bit / MOV DS,C / SETB SHCP / CLR SHCP（5 个机器周期）
+#define SEG_595_SHIFT_BIT(b)    { SEG_595_DS_PIN = (b); SEG_595_SHCP_PIN = 1; SEG_595_SHCP_PIN = 0; }
+
+//! 移出 seg_595_shift（8 位完全展开，最高位先移出）
+#define SEG_595_SHIFT_BYTE()                                                    \
+    SEG_595_SHIFT_BIT(SEG_595_SHIFT_7) SEG_595_SHIFT_BIT(SEG_595_SHIFT_6)       \
+    SEG_595_SHIFT_BIT(SEG_595_SHIFT_5) SEG_595_SHIFT_BIT(SEG_595_SHIFT_4)       \
+    SEG_595_SHIFT_BIT(SEG_595_SHIFT_3) SEG_595_SHIFT_BIT(SEG_595_SHIFT_2)       \
+    SEG_595_SHIFT_BIT(SEG_595_SHIFT_1) SEG_595_SHIFT_BIT(SEG_595_SHIFT_0)
+
+#endif
+
 
 
 /* ================== API 函数定义区域 ================== */
@@ -107,58 +159,52 @@
  */
 void segment_init_bsp(void)
 {
-    SEGMENT_PORT = 0x00;        //! 初始化数码管段选端口
-    DIGIT_PORT = 0x00;          //! 初始化数码管位选端口
-}
+    #if (SEG_DRIVER == SEG_DRIVER_74HC595)
+        SEG_595_SHCP_PIN = 0;
+        SEG_595_STCP_PIN = 0;
+        #if SEG_595_USE_OE
+            SEG_595_OE_PIN = 0;
+        #endif
+        segment_595_write(SEG_BLANK_BYTE, SEG_DIGIT_OFF);      //! 段码全灭，位选全部关闭
+    #elif (SEG_DRIVER == SEG_DRIVER_74HC138)
+        SEGMENT_PORT = SEG_BLANK_BYTE;      //! 初始化数码管段选端口（全灭）
+        DIGIT_PORT &= (uint8_t)~SEG_138_MASK;       //! 译码输入清零（选中第 0 位，段码全灭），端口其他引脚不变
+    #else
+        SEGMENT_PORT = SEG_BLANK_BYTE;      //! 初始化数码管段选端口（全灭）
+        DIGIT_PORT = SEG_DIGIT_OFF;         //! 初始化数码管位选端口（全部关闭）
+    #endif
 
-/**
- * @brief 输出要显示的段码数据
- * @param seg_data 要显示的数字
- * @return None
- */
-void segment_write_data(uint8_t seg_data)
-{
-    SEGMENT_PORT = segment_code_table[seg_data];
+    Timer0_Init();      //! 初始化定时器0，用于动态扫描
 }
 
+#if (SEG_DRIVER == SEG_DRIVER_74HC595)
+
 /**
- * @brief 选择显示的数码管位
- * @param index 位号（0 ~ SEG_DIGIT_COUNT-1）
+ * @brief 移出段码与位选并锁存（74HC595）
+ * @note 先移出位选（进入第 2 片），再移出段码（留在第 1 片）；16 位共约 80 个机器周期，
+ *       使用 OE 时锁存期间关闭输出并等待 SEG_BLANK_US
+ * @param seg 段码端口字节
+ * @param digit 位选端口字节
  * @return None
  */
-void segment_select_digit(uint8_t index)
+void segment_595_write(uint8_t seg, uint8_t digit)
 {
-    if(index >= SEG_DIGIT_COUNT)    return;     //! 如果 index >= 数码管个数，则直接返回
-
-    //! 判断是否使用38译码器
-    #if _74HC138
-        
+    seg_595_shift = digit;
+    SEG_595_SHIFT_BYTE()
+
+    seg_595_shift = seg;
+    SEG_595_SHIFT_BYTE()
+
+    #if SEG_595_USE_OE
+        SEG_595_OE_PIN = 1;         //! 关闭输出（消隐）
+        SEG_595_STCP_PIN = 1;
+        SEG_595_STCP_PIN = 0;
+        SEGMENT_BLANK_DELAY();
+        SEG_595_OE_PIN = 0;         //! 打开输出
     #else
-        //! 判断数码管类型
-        #if (SEG_TYPE == SEG_COMMON_ANODE)
-            DIGIT_PORT = (0x01 << index);   //! 共阳极
-        #elif (SEG_TYPE == SEG_COMMON_CATHODE)
-            DIGIT_PORT = ~(0x01 << index);   //! 共阴极
-        #endif
+        SEG_595_STCP_PIN = 1;       //! 上升沿锁存，段码与位选同时更新
+        SEG_595_STCP_PIN = 0;
     #endif
 }
 
-/**
- * @brief 关闭位选信号
- * @param None
- * @return None
- */
-void segment_noselect_digit(void)
-{
-    //! 判断是否使用38译码器
-    #if _74HC138
-        
-    #else
-        //! 判断数码管类型
-        #if (SEG_TYPE == SEG_COMMON_ANODE)
-            DIGIT_PORT = 0x00;          //! 共阳极
-        #elif (SEG_TYPE == SEG_COMMON_CATHODE)
-            DIGIT_PORT = 0xff;          //! 共阴极
-        #endif
-    #endif
-}
\ No newline at end of file
+#endif
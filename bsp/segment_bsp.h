@@ -1,21 +1,124 @@
 /**
  * @file    segment_bsp.h
  * @brief   数码管显示模块的 bsp 驱动头文件
- * @version 1.0.0
+ * @version 1.7.0
  * @author  ForeverMySunyu
- * @date    2025-12-19
+ * @date    2026-10-18
  *
  * @details 本文件用于数码管显示模块的板级驱动
+ *  - 段码表、位选表位于 code 区，按 SEG_TYPE 生成最终的端口电平，hal 层显示缓冲区直接保存端口字节
+ *  - 刷新接口为宏，驱动方式（直接驱动 / 74HC138 / 74HC595）由 SEG_DRIVER 在编译期选定，hal 层代码不变
+ *  - 直接驱动与 74HC138 展开后是对固定端口的 MOV 指令；74HC595 为完全展开的移位函数，在 Timer0 中断中执行
  */
 
 #ifndef _SEGMENT_BSP_H_
 #define _SEGMENT_BSP_H_
 
 #include <stdint.h>
+#include "../config/osc_configuration.h"
+#include "../config/segment_configuration.h"
+
+/* ================== 段码表索引 ================== */
+
+#define SEG_CODE_MINUS      10          //! 段码表中 '-' 的位置（0~9 为数字）
+#define SEG_CODE_BLANK      11          //! 段码表中全灭的位置
+#define SEG_CODE_FULL       12          //! 段码表中全亮的位置
+
+/* ================== 端口电平 ================== */
+
+//! 判断数码管类型
+#if (SEG_TYPE == SEG_COMMON_ANODE)
+    #define SEG_BLANK_BYTE      0xff                        //! 段码端口全灭
+    #define SEG_DIGIT_OFF       0x00                        //! 位选端口全部关闭
+    #define SEG_CODE_DP(seg)    ((uint8_t)((seg) & 0xfe))   //! 在段码上点亮小数点（dp 为 bit0，低电平点亮）
+    #define SEG_GLYPH_BYTE(g)   ((uint8_t)~(g))             //! 字形（置 1 的段点亮）转换为段码端口字节
+#elif (SEG_TYPE == SEG_COMMON_CATHODE)
+    #define SEG_BLANK_BYTE      0x00                        //! 段码端口全灭
+    #define SEG_DIGIT_OFF       0xff                        //! 位选端口全部关闭
+    #define SEG_CODE_DP(seg)    ((uint8_t)((seg) | 0x01))   //! 在段码上点亮小数点（dp 为 bit0，高电平点亮）
+    #define SEG_GLYPH_BYTE(g)   ((uint8_t)(g))              //! 字形（置 1 的段点亮）转换为段码端口字节
+#endif
+
+#define SEG_CODE_DP_TOGGLE(seg)     ((uint8_t)((seg) ^ 0x01))   //! 取反段码的小数点（与数码管类型无关）
+
+/* ================== 消隐等待 ================== */
+
+//! 消隐等待的循环次数（DJNZ 每次 2 个机器周期）
+#define SEG_BLANK_LOOPS     (SEG_BLANK_US * (FOSC_HZ / 1000) / (MACHINE_CYCLE * 2 * 1000UL))
+
+#if (SEG_BLANK_LOOPS > 0)
+    #define SEGMENT_BLANK_DELAY()       { uint8_t seg_blank_n = SEG_BLANK_LOOPS; while (--seg_blank_n); }
+#else
+    #define SEGMENT_BLANK_DELAY()       { }
+#endif
+
+/* ================== 刷新接口 ================== */
+
+/**
+ * @def SEGMENT_REFRESH(seg, index)
+ * @brief 刷新 1 位：消隐 + 等待 SEG_BLANK_US + 输出段码与位选
+ * @param seg 段码端口字节
+ * @param index 位号（0 ~ SEG_DIGIT_COUNT-1）
+ *
+ * @def SEGMENT_OUTPUT(seg, index)
+ * @brief 只改写段码（位选不变），用于同一位内的亮度调制分段
+ * @param seg 段码端口字节
+ * @param index 当前位号（74HC595 需要重新移出位选）
+ *
+ * @def SEG_REFRESH_CYCLES
+ * @brief 每次刷新耗时的上限（机器周期，含消隐等待），用于检查亮度调制的分段是否来得及
+ */
+#if (SEG_DRIVER == SEG_DRIVER_DIRECT)
+
+    //! 先关闭位选并等待驱动管截止，再输出段码、选择新的位（3 次端口写入）
+    #define SEGMENT_REFRESH(seg, index)     { DIGIT_PORT = SEG_DIGIT_OFF; SEGMENT_BLANK_DELAY(); SEGMENT_PORT = (seg); DIGIT_PORT = segment_digit_table[index]; }
+    #define SEGMENT_OUTPUT(seg, index)      { SEGMENT_PORT = (seg); }
+    #define SEG_REFRESH_CYCLES              (10 + SEG_BLANK_LOOPS * 2)
+
+#elif (SEG_DRIVER == SEG_DRIVER_74HC138)
+
+    //! 译码器总有一位被选中：先关闭段码，切换位选并等待后再输出段码；
+    //! 位选只改写 SEG_138_MASK 中的位：ANL/ORL 直接操作端口锁存器（读-改-写指令读锁存器而不是引脚），
+    //! 不会把按下的按键等外部拉低的引脚写成 0
+    #define SEGMENT_REFRESH(seg, index)                                                         \
+        {                                                                                       \
+            SEGMENT_PORT = SEG_BLANK_BYTE;                                                      \
+            DIGIT_PORT &= (uint8_t)~SEG_138_MASK;                                               \
+            DIGIT_PORT |= segment_digit_table[index];                                           \
+            SEGMENT_BLANK_DELAY();                                                              \
+            SEGMENT_PORT = (seg);                                                               \
+        }
+    #define SEGMENT_OUTPUT(seg, index)      { SEGMENT_PORT = (seg); }
+    #define SEG_REFRESH_CYCLES              (13 + SEG_BLANK_LOOPS * 2)
+
+#elif (SEG_DRIVER == SEG_DRIVER_74HC595)
+
+    //! 移出位选与段码（16 位）后锁存，16 路输出同时更新
+    #define SEGMENT_REFRESH(seg, index)     { segment_595_write((seg), segment_digit_table[index]); }
+    #define SEGMENT_OUTPUT(seg, index)      { segment_595_write((seg), segment_digit_table[index]); }
+    #define SEG_REFRESH_CYCLES              (95 + SEG_BLANK_LOOPS * 2)
+
+    //! 引脚定义
+    sbit    SEG_595_DS_PIN      =   SEG_595_DS;
+    sbit    SEG_595_SHCP_PIN    =   SEG_595_SHCP;
+    sbit    SEG_595_STCP_PIN    =   SEG_595_STCP;
+    #if SEG_595_USE_OE
+        sbit    SEG_595_OE_PIN  =   SEG_595_OE;
+    #endif
+
+    void segment_595_write(uint8_t seg, uint8_t digit);     //! 移出段码与位选并锁存
+
+#else
+    #error "The setting of SEG_DRIVER is incorrect."
+#endif
+
+/* ================== 查找表 ================== */
+
+extern uint8_t code segment_code_table[13];                 //! 段码表（0~9、'-'、全灭、全亮）
+extern uint8_t code segment_digit_table[8];                 //! 位选表（第 i 位的位选端口字节）
+extern uint8_t code segment_glyph_table[96];                //! ASCII 字形表（0x20 ~ 0x7f，与数码管类型无关）
 
 /* ================== API 函数声明区域 ================== */
-void segment_init_bsp(void);        //! 数码管显示初始化函数
-void segment_write_data(uint8_t seg_data);        //! 输出段码数据
-void segment_select_digit(uint8_t index);           //! 选择显示的数码管位
+void segment_init_bsp(void);        //! 数码管显示初始化函数（关闭显示并启动 Timer0）
 
-#endif      /* _SEGMENT_BSP_H_ */
\ No newline at end of file
+#endif      /* _SEGMENT_BSP_H_ */
@@ -0,0 +1,27 @@
+/**
+ * @file    spi_bsp.c
+ * @brief   SPI 底层驱动接口
+ * @note GPIO 模拟，软件模拟
+ * @version 1.0.0
+ * @author  ForeverMySunyu
+ * @date    2026-10-18
+ */
+
+#include "../config/spi_configuration.h"
+#include "spi_bsp.h"
+
+/*==================== API 函数定义区域 ====================*/
+
+/**
+ * @brief SPI 初始化函数
+ * @note SCLK 置为 CPOL 对应的空闲电平，CS 释放（不选中），MISO 写 1 作为输入（准双向口）
+ * @param None
+ * @return None
+ */
+void SPI_Init_bsp(void)
+{
+    CS_Set(1);
+    SCLK_Set(SPI_CPOL);
+    MOSI_Set(1);
+    SPI_MISO_PIN = 1;
+}
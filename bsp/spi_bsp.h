@@ -0,0 +1,37 @@
+/**
+ * @file    spi_bsp.h
+ * @brief   SPI 底层驱动接口
+ * @note GPIO 模拟，软件模拟
+ * @version 1.0.0
+ * @author  ForeverMySunyu
+ * @date    2026-10-18
+ *
+ * @details
+ *  - GPIO 操作接口为宏，展开后直接对固定引脚进行位操作（SETB/CLR/MOV C,bit），没有函数调用开销
+ */
+
+#ifndef _SPI_BSP_H_
+#define _SPI_BSP_H_
+
+#include <stdbool.h>
+#include "../config/spi_configuration.h"
+
+/*==================== 引脚定义区域 ====================*/
+
+sbit    SPI_SCLK_PIN    =   SPI_SCLK;
+sbit    SPI_MOSI_PIN    =   SPI_MOSI;
+sbit    SPI_MISO_PIN    =   SPI_MISO;
+sbit    SPI_CS_PIN      =   SPI_CS;
+
+/*==================== GPIO 操作接口 ====================*/
+
+#define SCLK_Set(level)     (SPI_SCLK_PIN = (level))        //! 设置 SCLK 电平（0-低电平，1-高电平）
+#define MOSI_Set(level)     (SPI_MOSI_PIN = (level))        //! 设置 MOSI 电平（0-低电平，1-高电平）
+#define MISO_Read()         (SPI_MISO_PIN)                  //! 读取 MISO 电平
+#define CS_Set(level)       (SPI_CS_PIN = (level))          //! 设置 CS 电平（0-选中，1-释放）
+
+/*==================== API 函数声明区域 ====================*/
+
+void SPI_Init_bsp(void);            //! SPI 初始化（SCLK 置为空闲电平，释放 CS 与 MISO）
+
+#endif  /* _SPI_BSP_H_ */
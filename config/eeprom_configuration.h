@@ -2,32 +2,138 @@
  * @file    eeprom_configuration.h
  * @brief   EEPROM 全局配置文件
  * @author  ForeverMySunyu
- * @version 1.0.0
- * @date    2025-12-29
+ * @version 1.3.0
+ * @date    2026-10-18
  *
  * @note
  *  - 通过修改本文件即可适配不同 EEPROM
- *  - 当前配置型号：AT24C02
+ *  - 通过 EEPROM_MODEL 选择 AT24C01 ~ AT24C512 型号，或填写自定义参数
  */
 
 #ifndef _EEPROM_CONFIGURATION_H_
 #define _EEPROM_CONFIGURATION_H_
 
+/* ========================= EEPROM 后端选择 ========================= */
+/**
+ * @note EEPROM_BACKEND_AT24：外部 AT24Cxx 串行 EEPROM（IIC），eeprom_hal.c 生效
+ * @note EEPROM_BACKEND_IAP：用单片机片内数据 Flash（IAP）模拟字节可写的 EEPROM，eeprom_iap_hal.c 生效，
+ *       不需要外部器件；两种后端提供相同的 EEPROM_* 接口，上层模块无需修改
+ */
+#define EEPROM_BACKEND_AT24     0
+#define EEPROM_BACKEND_IAP      1
+
+#define EEPROM_BACKEND          EEPROM_BACKEND_AT24     //! EEPROM 后端
+
+/* ========================= EEPROM 所在 IIC 总线配置 ========================= */
+
+#define EEPROM_IIC_BUS          0           //! EEPROM 挂接的 IIC 总线号（0 ~ IIC_BUS_NUM-1）
+
+/* ========================= EEPROM 型号配置 ========================= */
+/**
+ * |  EEPROM_MODEL  |    型号    |  容量（字节）  |  页大小（字节）  |  字地址字节数  |  块选择位  |
+ * | :------------: | :--------: | :------------: | :--------------: | :------------: | :--------: |
+ * |       1        |  AT24C01   |      128       |        8         |       1        |     0      |
+ * |       2        |  AT24C02   |      256       |        8         |       1        |     0      |
+ * |       4        |  AT24C04   |      512       |       16         |       1        |     1      |
+ * |       8        |  AT24C08   |     1024       |       16         |       1        |     2      |
+ * |      16        |  AT24C16   |     2048       |       16         |       1        |     3      |
+ * |      32        |  AT24C32   |     4096       |       32         |       2        |     0      |
+ * |      64        |  AT24C64   |     8192       |       32         |       2        |     0      |
+ * |     128        |  AT24C128  |    16384       |       64         |       2        |     0      |
+ * |     256        |  AT24C256  |    32768       |       64         |       2        |     0      |
+ * |     512        |  AT24C512  |    65536       |      128         |       2        |     0      |
+ * |       0        |   自定义   |  EEPROM_SIZE_BYTES / EEPROM_PAGE_SIZE / EEPROM_ADDR_BYTES 手动填写   ||||
+ *
+ * @note 块选择位：单字节字地址的器件容量超过 256 字节时，字地址的高位放在设备地址的 A0/A1/A2 位置，
+ *       这些位置对应的引脚不参与寻址，EEPROM_IIC_ADDR_Ax 的设置会被忽略
+ * @note 连续写入时每页只消耗 1 次内部写周期（EEPROM_WRITE_TIME_MS），页越大连续写入吞吐量越高：
+ *       吞吐量 ≈ EEPROM_PAGE_SIZE / (EEPROM_WRITE_TIME_MS + 一页数据的总线传输时间)
+ */
+#define EEPROM_MODEL            2
+
+#if EEPROM_MODEL == 1
+    #define EEPROM_SIZE_BYTES   128UL
+    #define EEPROM_PAGE_SIZE    8
+    #define EEPROM_ADDR_BYTES   1
+#elif EEPROM_MODEL == 2
+    #define EEPROM_SIZE_BYTES   256UL
+    #define EEPROM_PAGE_SIZE    8
+    #define EEPROM_ADDR_BYTES   1
+#elif EEPROM_MODEL == 4
+    #define EEPROM_SIZE_BYTES   512UL
+    #define EEPROM_PAGE_SIZE    16
+    #define EEPROM_ADDR_BYTES   1
+#elif EEPROM_MODEL == 8
+    #define EEPROM_SIZE_BYTES   1024UL
+    #define EEPROM_PAGE_SIZE    16
+    #define EEPROM_ADDR_BYTES   1
+#elif EEPROM_MODEL == 16
+    #define EEPROM_SIZE_BYTES   2048UL
+    #define EEPROM_PAGE_SIZE    16
+    #define EEPROM_ADDR_BYTES   1
+#elif EEPROM_MODEL == 32
+    #define EEPROM_SIZE_BYTES   4096UL
+    #define EEPROM_PAGE_SIZE    32
+    #define EEPROM_ADDR_BYTES   2
+#elif EEPROM_MODEL == 64
+    #define EEPROM_SIZE_BYTES   8192UL
+    #define EEPROM_PAGE_SIZE    32
+    #define EEPROM_ADDR_BYTES   2
+#elif EEPROM_MODEL == 128
+    #define EEPROM_SIZE_BYTES   16384UL
+    #define EEPROM_PAGE_SIZE    64
+    #define EEPROM_ADDR_BYTES   2
+#elif EEPROM_MODEL == 256
+    #define EEPROM_SIZE_BYTES   32768UL
+    #define EEPROM_PAGE_SIZE    64
+    #define EEPROM_ADDR_BYTES   2
+#elif EEPROM_MODEL == 512
+    #define EEPROM_SIZE_BYTES   65536UL
+    #define EEPROM_PAGE_SIZE    128
+    #define EEPROM_ADDR_BYTES   2
+#elif EEPROM_MODEL == 0
+    #define EEPROM_SIZE_BYTES   256UL       //! EEPROM 总存储容量（单位：字节，最大 65536）
+    #define EEPROM_PAGE_SIZE    8           //! EEPROM 页大小（单位：字节，8/16/32/64/128）
+    #define EEPROM_ADDR_BYTES   1           //! 字地址字节数（1 或 2）
+#else
+    #error "The setting of EEPROM_MODEL is incorrect."
+#endif
+
+#if (EEPROM_PAGE_SIZE != 8) && (EEPROM_PAGE_SIZE != 16) && (EEPROM_PAGE_SIZE != 32) && (EEPROM_PAGE_SIZE != 64) && (EEPROM_PAGE_SIZE != 128)
+    #error "EEPROM_PAGE_SIZE must be 8, 16, 32, 64 or 128"
+#endif
+
+#if (EEPROM_ADDR_BYTES != 1) && (EEPROM_ADDR_BYTES != 2)
+    #error "EEPROM_ADDR_BYTES must be 1 or 2"
+#endif
+
+#if (EEPROM_SIZE_BYTES > 65536UL) || ((EEPROM_ADDR_BYTES == 1) && (EEPROM_SIZE_BYTES > 2048UL))
+    #error "EEPROM_SIZE_BYTES is out of range for EEPROM_ADDR_BYTES"
+#endif
+
+#define EEPROM_PAGE_NUM         ((uint16_t)(EEPROM_SIZE_BYTES / EEPROM_PAGE_SIZE))     //! EEPROM 总页数（单位：页）
+
+/* 块选择位数：单字节字地址时，超出 256 字节的地址高位个数 */
+#if (EEPROM_ADDR_BYTES == 1) && (EEPROM_SIZE_BYTES > 1024UL)
+    #define EEPROM_BLOCK_BITS   3
+#elif (EEPROM_ADDR_BYTES == 1) && (EEPROM_SIZE_BYTES > 512UL)
+    #define EEPROM_BLOCK_BITS   2
+#elif (EEPROM_ADDR_BYTES == 1) && (EEPROM_SIZE_BYTES > 256UL)
+    #define EEPROM_BLOCK_BITS   1
+#else
+    #define EEPROM_BLOCK_BITS   0
+#endif
+
+#define EEPROM_BLOCK_MASK       ((uint8_t)(((1 << EEPROM_BLOCK_BITS) - 1) << 1))        //! 设备地址中块选择位的掩码
+
 /* ========================= EEPROM IIC 设备地址配置 ========================= */
 
 #define EEPROM_IIC_ADDR_MANDATORY_SEQUENCE        0xA0
 #define EEPROM_IIC_ADDR_A2      0
 #define EEPROM_IIC_ADDR_A1      0
 #define EEPROM_IIC_ADDR_A0      0
-/* 根据以上4个宏计算得到 EEPROM 的 IIC 设备地址 */
-#define EEPROM_IIC_ADDR         EEPROM_IIC_ADDR_MANDATORY_SEQUENCE + (EEPROM_IIC_ADDR_A2 * 2*2*2) + (EEPROM_IIC_ADDR_A1 * 2*2) + (EEPROM_IIC_ADDR_A0 * 2)
-
-/* ========================= EEPROM 存储参数配置 ========================= */
-
-#define EEPROM_TOTAL_SIZE_BIT   2048                                        //! EEPROM 总存储容量（单位：bit）
-#define EEPROM_TOTAL_SIZE_KB    EEPROM_TOTAL_SIZE_BIT/8                     //! EEPROM 总存储容量（单位：KB）
-#define EEPROM_PAGE_SIZE_KB     8                                           //! EEPROM 页存储容量（单位：KB）
-#define EEPROM_MAX_PAGE_NUM     EEPROM_TOTAL_SIZE_KB/EEPROM_PAGE_SIZE_KB    //! EEPROM 总页数（单位：页）
+/* 根据以上4个宏计算得到 EEPROM 的 IIC 设备地址（块选择位所在的位置清零） */
+#define EEPROM_IIC_ADDR         ((EEPROM_IIC_ADDR_MANDATORY_SEQUENCE + (EEPROM_IIC_ADDR_A2 * 2*2*2) + (EEPROM_IIC_ADDR_A1 * 2*2) + (EEPROM_IIC_ADDR_A0 * 2)) & ~EEPROM_BLOCK_MASK)
 
 /* ========================= EEPROM 内部写周期时间配置（单位：MS） ========================= */
 #define EEPROM_WRITE_TIME_MS    5
@@ -35,4 +141,138 @@
 /* ========================= ACK Polling 最大重试次数 ========================= */
 #define EEPROM_ACK_POLLING_MAX_TRY   100
 
+/* ========================= 片内 IAP Flash 模拟配置（eeprom_iap_hal.c） ========================= */
+/**
+ * @note 使用 2 个数据 Flash 扇区（每个 512 字节）交替保存，末尾 2 字节为扇区标记（序号、序号取反）；
+ *       EEPROM_SIZE_BYTES（由 EEPROM_MODEL 决定，IAP 后端可选 1、2 或自定义）不能超过 510
+ * @note 扇区起始地址见数据手册 EEPROM 章节（与型号有关，例如 STC89C51RC/52RC 第 1 个扇区为 0x2000）
+ */
+#define EEPROM_IAP_SECTOR_A     0x2000      //! 扇区 A 起始地址（512 字节对齐）
+#define EEPROM_IAP_SECTOR_B     0x2200      //! 扇区 B 起始地址（512 字节对齐）
+
+/* ========================= 比较写入配置（EEPROM_WriteMultiByte） ========================= */
+/**
+ * @note 比较写入：写入前先读出每页的目标区间，内容相同的页不写，不同的页只写第一个到最后一个不同字节之间的部分
+ * @note 开启后额外占用 EEPROM_PAGE_SIZE 字节 xdata 作为比较缓冲区，每页多 1 次顺序读（远短于 1 次写周期）
+ */
+#define EEPROM_WRITE_COMPARE            1   //! 0-不编译比较写入，1-编译比较写入
+#define EEPROM_WRITE_COMPARE_DEFAULT    1   //! 上电后默认是否启用比较写入（可由 EEPROM_Set_CompareWrite() 修改）
+
+/* ========================= 异步写入配置（eeprom_async_hal.c） ========================= */
+/**
+ * @note 异步写入队列中每项只保存调用者缓冲区的指针，写入完成前缓冲区内容不能改变
+ */
+#define EEPROM_ASYNC_QUEUE_LEN      4       //! 异步写入队列长度（1~8）
+#define EEPROM_ASYNC_TIMEOUT_MS     20      //! 单页写周期超时时间（ms），超时仍无应答则该次写入失败
+
+#if (EEPROM_ASYNC_QUEUE_LEN < 1) || (EEPROM_ASYNC_QUEUE_LEN > 8)
+    #error "EEPROM_ASYNC_QUEUE_LEN must be between 1 and 8"
+#endif
+
+/* ========================= 键值存储配置（eeprom_kv_hal.c） ========================= */
+/**
+ * @note 键值存储区由 EEPROM_KV_SECTOR_NUM 个扇区组成，按环形顺序追加记录，写满后回收最旧的扇区
+ * @note 记录格式：键(1) + 长度(1) + CRC16(2) + 数据，记录不跨页，每次更新只消耗 1 次页写入
+ * @note 为保证回收一定成功，全部键的最新记录（每条按 2 倍记录长度计算页尾浪费）必须能放入 1 个扇区
+ * @note 默认存储区划分（互不重叠，见本文件末尾的重叠检查）：| 键值存储区 | 循环日志区 | A/B 配置槽 |
+ *       键值存储区从 0 开始，不超过容量的 1/2；配置槽在末尾；日志区占用两者之间的全部空间
+ */
+#define EEPROM_KV_BASE_ADDR     0x0000                          //! 存储区起始地址（页对齐）
+#define EEPROM_KV_SECTOR_NUM    2                               //! 扇区个数（2~8）
+
+/* 扇区大小上限与单个值的最大字节数（不超过 页大小-4），默认值按页大小选取 */
+#if (EEPROM_PAGE_SIZE <= 8)
+    #define EEPROM_KV_SECTOR_MAX    128
+    #define EEPROM_KV_VALUE_MAX     (EEPROM_PAGE_SIZE - 4)
+#elif (EEPROM_PAGE_SIZE <= 16)
+    #define EEPROM_KV_SECTOR_MAX    256
+    #define EEPROM_KV_VALUE_MAX     (EEPROM_PAGE_SIZE - 4)
+#else
+    #define EEPROM_KV_SECTOR_MAX    512
+    #define EEPROM_KV_VALUE_MAX     16
+#endif
+
+/* 扇区大小（页大小的整数倍）：不超过容量的 1/4，为日志区和配置槽留出空间；键的个数按扇区大小选取 */
+#if (EEPROM_SIZE_BYTES / 4 < EEPROM_KV_SECTOR_MAX)
+    #define EEPROM_KV_SECTOR_SIZE   (EEPROM_SIZE_BYTES / 4)
+    #define EEPROM_KV_KEY_NUM       2                           //! 键的个数（键值 0 ~ EEPROM_KV_KEY_NUM-1，小容量器件扇区缩小）
+#else
+    #define EEPROM_KV_SECTOR_SIZE   EEPROM_KV_SECTOR_MAX
+    #define EEPROM_KV_KEY_NUM       6                           //! 键的个数（键值 0 ~ EEPROM_KV_KEY_NUM-1）
+#endif
+
+/* ========================= A/B 配置槽配置（eeprom_cfg_hal.c） ========================= */
+/**
+ * @note 配置数据交替保存在 A、B 两个槽中，每个槽 = 8 字节槽头 + 数据，槽头最后写入，掉电时总有 1 个完整的槽
+ * @note 默认放在 EEPROM 末尾，每个槽不超过容量的 1/8（两个槽不超过 1/4），与键值存储区、日志区不重叠
+ */
+#if (EEPROM_PAGE_SIZE > 64)
+    #define EEPROM_CFG_SLOT_SIZE    EEPROM_PAGE_SIZE                //! 每个槽的大小（字节，页大小的整数倍）
+#elif (EEPROM_SIZE_BYTES / 8 < 64)
+    #define EEPROM_CFG_SLOT_SIZE    (EEPROM_SIZE_BYTES / 8)
+#else
+    #define EEPROM_CFG_SLOT_SIZE    64
+#endif
+#define EEPROM_CFG_BASE_ADDR    (EEPROM_SIZE_BYTES - 2 * EEPROM_CFG_SLOT_SIZE)     //! 槽 A 起始地址（页对齐），槽 B 紧随其后
+
+/* ========================= 循环日志配置（eeprom_log_hal.c） ========================= */
+/**
+ * @note 日志区由 EEPROM_LOG_BLOCK_NUM 个块组成，每块 = 5 字节块头（序号、记录数、CRC16）+ 若干条记录，
+ *       每条记录 = 4 字节时间戳 + EEPROM_LOG_DATA_SIZE 字节数据；写满后覆盖最旧的块
+ * @note 块大小为页大小的整数倍，页大小 >= 32 时 1 块 = 1 页，每写满 1 块只消耗 1 次页写入
+ */
+#if (EEPROM_PAGE_SIZE < 32)
+    #define EEPROM_LOG_BLOCK_SIZE   32                                      //! 块大小（字节，页大小的整数倍）
+#else
+    #define EEPROM_LOG_BLOCK_SIZE   EEPROM_PAGE_SIZE
+#endif
+#define EEPROM_LOG_BASE_ADDR    (EEPROM_KV_BASE_ADDR + EEPROM_KV_SECTOR_NUM * EEPROM_KV_SECTOR_SIZE)     //! 日志区起始地址（块对齐，默认紧接键值存储区）
+#define EEPROM_LOG_BLOCK_NUM    ((EEPROM_CFG_BASE_ADDR - EEPROM_LOG_BASE_ADDR) / EEPROM_LOG_BLOCK_SIZE)  //! 块数（2~2048，默认占满到配置槽之前）
+#define EEPROM_LOG_DATA_SIZE    4                                           //! 每条记录的数据字节数（不含时间戳）
+
+/* ========================= 页缓存配置（eeprom_cache_hal.c） ========================= */
+/**
+ * @note 页缓存位于 xdata，占用 EEPROM_CACHE_PAGES * (EEPROM_PAGE_SIZE + EEPROM_PAGE_SIZE/8 + 4) 字节
+ * @note 同一页内的多次零散写入在 RAM 中合并，刷新时整页只消耗 1 次内部写周期
+ */
+#define EEPROM_CACHE_PAGES      2           //! 缓存页数（1~8）
+#define EEPROM_CACHE_FLUSH_MS   500         //! 首次写入缓存后自动刷新的延迟（ms），0 表示只在调用 EEPROM_Cache_Flush() 时刷新
+
+#if (EEPROM_CACHE_PAGES < 1) || (EEPROM_CACHE_PAGES > 8)
+    #error "EEPROM_CACHE_PAGES must be between 1 and 8"
+#endif
+
+/* ========================= 顺序读取游标配置（eeprom_cursor_hal.c） ========================= */
+/**
+ * @note 预读缓冲区位于 xdata；每次补充用 1 次顺序读读满缓冲区，地址发送开销（约 4 字节）由缓冲区内的全部字节分摊
+ */
+#define EEPROM_CURSOR_BUF_SIZE  EEPROM_PAGE_SIZE    //! 预读缓冲区大小（字节，1~255）
+
+#if (EEPROM_CURSOR_BUF_SIZE < 1) || (EEPROM_CURSOR_BUF_SIZE > 255)
+    #error "EEPROM_CURSOR_BUF_SIZE must be between 1 and 255"
+#endif
+
+/* ========================= 存储区重叠检查 ========================= */
+/**
+ * @note 键值存储区、A/B 配置槽、循环日志区两两之间不能重叠（即使某个模块未使用，也要保持其区域不与其他区域重叠）
+ */
+#define EEPROM_KV_END_ADDR      (EEPROM_KV_BASE_ADDR + EEPROM_KV_SECTOR_NUM * EEPROM_KV_SECTOR_SIZE * 1UL)     //! 键值存储区结束地址（不含）
+#define EEPROM_CFG_END_ADDR     (EEPROM_CFG_BASE_ADDR + 2 * EEPROM_CFG_SLOT_SIZE * 1UL)                       //! 配置槽结束地址（不含）
+#define EEPROM_LOG_END_ADDR     (EEPROM_LOG_BASE_ADDR + EEPROM_LOG_BLOCK_NUM * EEPROM_LOG_BLOCK_SIZE * 1UL)    //! 日志区结束地址（不含）
+
+//! [a_base, a_end) 与 [b_base, b_end) 是否重叠
+#define EEPROM_AREA_OVERLAP(a_base, a_end, b_base, b_end)       (((a_base) < (b_end)) && ((b_base) < (a_end)))
+
+#if EEPROM_AREA_OVERLAP(EEPROM_KV_BASE_ADDR, EEPROM_KV_END_ADDR, EEPROM_CFG_BASE_ADDR, EEPROM_CFG_END_ADDR)
+    #error "EEPROM key/value area overlaps the config slots"
+#endif
+
+#if EEPROM_AREA_OVERLAP(EEPROM_KV_BASE_ADDR, EEPROM_KV_END_ADDR, EEPROM_LOG_BASE_ADDR, EEPROM_LOG_END_ADDR)
+    #error "EEPROM key/value area overlaps the log area"
+#endif
+
+#if EEPROM_AREA_OVERLAP(EEPROM_CFG_BASE_ADDR, EEPROM_CFG_END_ADDR, EEPROM_LOG_BASE_ADDR, EEPROM_LOG_END_ADDR)
+    #error "EEPROM config slots overlap the log area"
+#endif
+
 #endif      /* _EEPROM_CONFIGURATION_H_ */
\ No newline at end of file
@@ -1,32 +1,116 @@
 /**
  * @file    iic_configuration.h
  * @brief   IIC（I2C）通信参数配置文件
- * @version 1.0.0
+ * @version 1.3.0
  * @author  ForeverMySunyu
- * @date    2025-12-23
+ * @date    2026-10-18
  *
  * @details
  * 本文件用于统一配置 IIC 通信所需的参数，
  * 包括 IIC 使用的 IO 口及时序延时。
+ *
+ * @note
+ *  - 支持 1~4 条相互独立的软件模拟 IIC 总线，每条总线一行配置（引脚 + 时序）
+ *  - 编译时由总线表为每条总线单独生成一套驱动函数（IIC0_xxx、IIC1_xxx ...），
+ *    引脚以 sbit 常量直接访问，不在运行时按总线号查表
+ *  - 慢速器件与高速器件可以分别挂在不同总线上，各自使用最合适的时序延时
+ *  - 超时以微秒为单位配置，编译时按 FOSC_HZ / MACHINE_CYCLE 换算为轮询次数
  */
 
 #ifndef _IIC_CONFIGURATION_H_
 #define _IIC_CONFIGURATION_H_
 
+#include "osc_configuration.h"
+
+/*==================== 主机仿真配置 ====================*/
+/**
+ * @brief 是否使用主机仿真 BSP（0-真实硬件，1-主机仿真）
+ * @note  仿真时 SCL/SDA 操作接到 bsp/iic_sim_bsp.c 中的开漏总线模型，
+ *        可在 PC 上用 gcc 编译 IIC / EEPROM HAL 进行协议与时序检查，编译命令见 iic_sim_bsp.h。
+ *        通常在编译命令中以 -DIIC_BSP_SIMULATION=1 打开，不要在本文件中修改
+ */
+#ifndef IIC_BSP_SIMULATION
+#define IIC_BSP_SIMULATION      0
+#endif
+
+#if !IIC_BSP_SIMULATION
 #include "../core/stc89.h"
+#endif
+
+/*==================== IIC 总线数量 ====================*/
 
-/*==================== IIC 引脚配置 ====================*/
+#define IIC_BUS_NUM     1       //! 使用的 IIC 总线数量（1~4）
+
+#if (IIC_BUS_NUM < 1) || (IIC_BUS_NUM > 4)
+#error "IIC_BUS_NUM must be between 1 and 4"
+#endif
+
+/*==================== IIC 总线表（引脚 + 时序） ====================*/
+/**
+ * |  总线  |  SCL 引脚  |  SDA 引脚  |  时序延时（单位：10us，0 表示不插入延时）  |  时钟延展  |
+ * | :----: | :--------: | :--------: | :--------------------------------------: | :--------: |
+ * | IIC0   |   P2^0     |   P2^1     |                  1                       |     0      |
+ * | IIC1   |   P2^2     |   P2^3     |                  0                       |     0      |
+ * | IIC2   |   P2^4     |   P2^5     |                  1                       |     0      |
+ * | IIC3   |   P2^6     |   P2^7     |                  1                       |     0      |
+ *
+ * @note 时钟延展（clock stretching）为 1 时，主机每次释放 SCL 后都会等待 SCL 真正变高
+ *       （最长 IIC_STRETCH_TIMEOUT_US），总线上有会拉低 SCL 的从机时才需要打开
+ *
+ * @note 只有序号 < IIC_BUS_NUM 的总线会被编译
+ */
 
-#define IIC_SCL P2^0            //! IIC 时钟线 SCL
-#define IIC_SDA P2^1            //! IIC 数据线 SDA
+#define IIC0_SCL            P2^0        //! IIC0 时钟线 SCL
+#define IIC0_SDA            P2^1        //! IIC0 数据线 SDA
+#define IIC0_DELAY_10US     1           //! IIC0 时序延时（单位：10微秒（10us））
+#define IIC0_CLOCK_STRETCH  0           //! IIC0 是否支持从机时钟延展（0-不支持，1-支持）
 
-/*==================== IIC 时序配置 ====================*/
+#define IIC1_SCL            P2^2        //! IIC1 时钟线 SCL
+#define IIC1_SDA            P2^3        //! IIC1 数据线 SDA
+#define IIC1_DELAY_10US     0           //! IIC1 时序延时（单位：10微秒（10us））
+#define IIC1_CLOCK_STRETCH  0           //! IIC1 是否支持从机时钟延展（0-不支持，1-支持）
 
-#define IIC_DELAY_10US   1        //! IIC 时序延时（单位：10微秒（10us））
+#define IIC2_SCL            P2^4        //! IIC2 时钟线 SCL
+#define IIC2_SDA            P2^5        //! IIC2 数据线 SDA
+#define IIC2_DELAY_10US     1           //! IIC2 时序延时（单位：10微秒（10us））
+#define IIC2_CLOCK_STRETCH  0           //! IIC2 是否支持从机时钟延展（0-不支持，1-支持）
 
-/*==================== 超时配置 ====================*/
+#define IIC3_SCL            P2^6        //! IIC3 时钟线 SCL
+#define IIC3_SDA            P2^7        //! IIC3 数据线 SDA
+#define IIC3_DELAY_10US     1           //! IIC3 时序延时（单位：10微秒（10us））
+#define IIC3_CLOCK_STRETCH  0           //! IIC3 是否支持从机时钟延展（0-不支持，1-支持）
 
-#define IIC_ACK_TIMEOUT  600   //! ACK 等待超时计数
-#define IIC_BUS_IDLE_TIMEOUT    600     //! 总线空闲检测超时计数
+/*==================== 超时配置（单位：微秒，与晶振频率无关） ====================*/
+
+#define IIC_ACK_TIMEOUT_US          100     //! 等待从机 ACK 的最长时间（us）
+#define IIC_BUS_IDLE_TIMEOUT_US     500     //! 等待总线空闲（SCL、SDA 均为高）的最长时间（us）
+#define IIC_STRETCH_TIMEOUT_US      200     //! 等待从机释放 SCL（时钟延展）的最长时间（us）
+
+/**
+ * @brief 超时轮询循环每次迭代消耗的机器周期数
+ * @note  对应 while (引脚条件 && --count); 的循环体（JB/JNB + 16 位计数递减），
+ *        Keil C51 默认优化等级下约为 8 个机器周期，更换编译器或优化等级后需重新核对列表文件（.lst）
+ */
+#define IIC_POLL_LOOP_CYCLES        8
+
+/**
+ * @brief 把微秒换算为轮询循环次数（编译期计算，至少为 1）
+ * @note  FOSC_HZ / MACHINE_CYCLE / 1000 为每毫秒的机器周期数，先除 1000 可避免 32 位预处理运算溢出
+ */
+#define IIC_US_TO_POLLS(us)         ((uint16_t)(((us) * (FOSC_HZ / MACHINE_CYCLE / 1000)) / 1000 / IIC_POLL_LOOP_CYCLES + 1))
+
+#define IIC_ACK_TIMEOUT_POLLS       IIC_US_TO_POLLS(IIC_ACK_TIMEOUT_US)         //! ACK 等待超时（轮询次数）
+#define IIC_BUS_IDLE_TIMEOUT_POLLS  IIC_US_TO_POLLS(IIC_BUS_IDLE_TIMEOUT_US)    //! 总线空闲等待超时（轮询次数）
+#define IIC_STRETCH_TIMEOUT_POLLS   IIC_US_TO_POLLS(IIC_STRETCH_TIMEOUT_US)     //! 时钟延展等待超时（轮询次数）
+
+/*==================== 总线故障恢复策略配置 ====================*/
+/**
+ * @brief IIC_Start() 发现总线忙时，按以下顺序逐级升级处理：
+ *        1. IIC_Bus_Recover()  —— 9 个 SCL 脉冲 + STOP，释放被从机拉低的 SDA
+ *        2. IIC_Slave_Reset()  —— START + 9 个 SCL 脉冲 + START + STOP，复位从机状态机
+ *        3. 退避（back-off）    —— 之后的 IIC_BACKOFF_STARTS 次 IIC_Start() 不再访问总线，直接返回总线忙
+ * @note  退避期间每次 IIC_Start() 只消耗几个机器周期，故障器件不会反复拖慢主程序
+ */
+#define IIC_BACKOFF_STARTS          16      //! 恢复失败后跳过的 IIC_Start() 次数（0 表示不退避，1~255）
 
 #endif      /* _IIC_CONFIGURATION_H_ */
\ No newline at end of file
@@ -0,0 +1,74 @@
+/**
+ * @file    onewire_configuration.h
+ * @brief   1-Wire（单总线）通信及 DS18B20 参数配置文件
+ * @version 1.0.0
+ * @author  ForeverMySunyu
+ * @date    2026-10-18
+ *
+ * @details
+ * 本文件用于统一配置 1-Wire 总线使用的 IO 口、各时隙时序，以及 DS18B20 的分辨率。
+ *
+ * @note
+ *  - 1-Wire 时序窗口为 1~15us 级别，远小于 delay_10us() 的分辨率，
+ *    onewire_hal.c 按 FOSC_HZ / MACHINE_CYCLE 在编译期把以下微秒值换算为 DJNZ 循环次数，直接内联到时隙代码中
+ *  - 时序值参考 DS18B20 数据手册（标准速度），一般无需修改
+ */
+
+#ifndef _ONEWIRE_CONFIGURATION_H_
+#define _ONEWIRE_CONFIGURATION_H_
+
+#include "../core/stc89.h"
+#include "osc_configuration.h"
+
+/*==================== 1-Wire 引脚配置 ====================*/
+
+#define ONEWIRE_DQ      P3^7        //! 1-Wire 数据线 DQ（需外接 4.7k 上拉电阻）
+
+/*==================== 时隙时序配置（单位：微秒） ====================*/
+/**
+ * @note 复位与应答（中断只在 “释放总线 → 采样应答脉冲” 期间关闭）：
+ *       |<---- RESET_LOW ---->|<- PRESENCE_WAIT ->| 采样 |<---- RESET_RECOVERY ---->|
+ *
+ *       写时隙（中断只在拉低期间关闭）：
+ *       写 0：|<-- WRITE0_LOW -->|<- WRITE0_RECOVERY ->|
+ *       写 1：|<- WRITE1_LOW ->|<------- WRITE1_RECOVERY ------->|
+ *
+ *       读时隙（中断在 “拉低 → 采样” 期间关闭，采样点需在下降沿后 15us 以内）：
+ *       |<- READ_LOW ->|<- READ_SAMPLE ->| 采样 |<---- READ_RECOVERY ---->|
+ */
+#define ONEWIRE_RESET_LOW_US        480     //! 复位脉冲低电平时间（480~960us，按 60us 为单位执行）
+#define ONEWIRE_PRESENCE_WAIT_US    70      //! 释放总线后到采样应答脉冲的时间（60~75us）
+#define ONEWIRE_RESET_RECOVERY_US   420     //! 采样应答脉冲后的恢复时间（按 60us 为单位执行，复位时隙总长 >= 480us）
+
+#define ONEWIRE_WRITE0_LOW_US       60      //! 写 0 时隙低电平时间（60~120us）
+#define ONEWIRE_WRITE0_RECOVERY_US  5       //! 写 0 时隙恢复时间（>= 1us）
+#define ONEWIRE_WRITE1_LOW_US       6       //! 写 1 时隙低电平时间（1~15us）
+#define ONEWIRE_WRITE1_RECOVERY_US  60      //! 写 1 时隙释放时间（时隙总长 >= 60us）
+
+#define ONEWIRE_READ_LOW_US         2       //! 读时隙低电平时间（>= 1us）
+#define ONEWIRE_READ_SAMPLE_US      6       //! 释放总线后到采样的时间（与 READ_LOW 及引脚操作之和 < 15us）
+#define ONEWIRE_READ_RECOVERY_US    55      //! 采样后的时隙剩余时间（时隙总长 >= 60us）
+
+/**
+ * @brief 内联延时循环的固定开销（机器周期）
+ * @note  循环为 MOV Rn,#n（1 个机器周期）+ n 次 DJNZ Rn（每次 2 个机器周期），
+ *        Keil C51 默认优化等级下 { uint8_t data n = N; while (--n); } 编译为该指令序列，
+ *        更换编译器或优化等级后需重新核对列表文件（.lst）
+ */
+#define ONEWIRE_DELAY_OVERHEAD_CYCLES   1
+
+/*==================== DS18B20 配置 ====================*/
+
+#define DS18B20_RESOLUTION      12      //! 温度分辨率（9~12 位，对应 0.5 / 0.25 / 0.125 / 0.0625 ℃）
+
+#if (DS18B20_RESOLUTION < 9) || (DS18B20_RESOLUTION > 12)
+#error "DS18B20_RESOLUTION must be between 9 and 12"
+#endif
+
+//! 温度转换时间（ms）：12 位 750ms，每降低 1 位减半
+#define DS18B20_CONVERT_MS      ((750 >> (12 - DS18B20_RESOLUTION)) + 1)
+
+#define DS18B20_ALARM_TH        0x7F    //! 高温报警阈值寄存器 TH（写入配置时使用）
+#define DS18B20_ALARM_TL        0x80    //! 低温报警阈值寄存器 TL（写入配置时使用）
+
+#endif      /* _ONEWIRE_CONFIGURATION_H_ */
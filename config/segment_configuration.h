@@ -1,13 +1,13 @@
 /**
  * @file    segment_configuration.h
  * @brief   数码管显示模块的全局配置文件
- * @version 1.0.0
+ * @version 1.3.0
  * @author  ForeverMySunyu
- * @date    2025-12-19
+ * @date    2026-10-18
  *
  * @details
  * 本文件用于配置数码管显示模块的所有可变参数，
- * 包括显示位数、共阳/共阴类型等。
+ * 包括显示位数、共阳/共阴类型、刷新频率等。
  * 修改配置无需修改驱动源码。
  */
 
@@ -29,13 +29,94 @@ typedef enum
 /** @brief 当前数码管类型选择 */
 #define SEG_TYPE               SEG_COMMON_ANODE
 
-/** @brief 是否使用38译码器（0-不使用，1-使用） */
-#define _74HC138               0
+/** @brief 驱动方式定义（不要修改） */
+#define SEG_DRIVER_DIRECT      0        /**< 段码、位选直接接端口 */
+#define SEG_DRIVER_74HC138     1        /**< 段码直接接端口，位选经 74HC138 译码（位号输出到 DIGIT_PORT） */
+#define SEG_DRIVER_74HC595     2        /**< 段码与位选经 2 片级联的 74HC595 串行输出（3~4 个引脚） */
 
-/** @brief 段码端口（a~g, dp） */
+/**
+ * @brief 当前驱动方式选择
+ * @note 每次刷新的耗时（机器周期，不含消隐等待）：直接驱动约 10，74HC138 约 13，74HC595 约 95
+ */
+#define SEG_DRIVER             SEG_DRIVER_DIRECT
+
+/** @brief 段码端口（a~g, dp），SEG_DRIVER_DIRECT / SEG_DRIVER_74HC138 使用 */
 #define SEGMENT_PORT       P1
 
-/** @brief 位选端口 */
+/** @brief 位选端口，SEG_DRIVER_DIRECT / SEG_DRIVER_74HC138 使用 */
 #define DIGIT_PORT         P2
 
+/**
+ * @brief 74HC138 的译码输入 A0 在 DIGIT_PORT 中的位置（0~5），SEG_DRIVER_74HC138 使用
+ * @note 译码输入占 DIGIT_PORT 的 SEG_138_SHIFT ~ SEG_138_SHIFT+2 位（SEG_138_MASK），刷新时只改写这 3 位，
+ *       端口的其他引脚（如 P2.3~P2.7 上的独立按键、IIC1）保持不变
+ */
+#define SEG_138_SHIFT          0
+#define SEG_138_MASK           (0x07 << SEG_138_SHIFT)
+
+/**
+ * @brief 74HC595 引脚，SEG_DRIVER_74HC595 使用
+ * @details 第 1 片（DS 直接与单片机相连）输出段码，第 2 片（级联在第 1 片的 Q7' 后）输出位选
+ */
+#define SEG_595_DS             P3^4     //! 串行数据 DS
+#define SEG_595_SHCP           P3^5     //! 移位时钟 SHCP（上升沿移入 1 位）
+#define SEG_595_STCP           P3^6     //! 锁存时钟 STCP（上升沿更新输出）
+
+/**
+ * @brief 是否使用 74HC595 的输出使能引脚 OE（0-不使用，OE 接地；1-使用）
+ * @note 74HC595 锁存时 16 路输出同时更新，不存在端口先后写入造成的残影；
+ *       需要消隐时间（SEG_BLANK_US）时必须使用 OE：锁存期间关闭输出并等待 SEG_BLANK_US
+ */
+#define SEG_595_USE_OE         0
+#define SEG_595_OE             P3^7     //! 输出使能 OE（低电平有效）
+
+/**
+ * @brief 整屏刷新频率，单位：Hz（50~1000）
+ * @details 动态扫描由 Timer0 中断驱动，每次中断刷新 1 位，主循环阻塞时显示不受影响
+ */
+#define SEG_REFRESH_HZ         100
+
+/**
+ * @brief 每位切换时的消隐时间，单位：微秒 (us)（0~50）
+ * @details 关闭位选后等待驱动管截止再输出下一位的段码，消除残影；
+ *          在中断内忙等，计入每次中断的耗时，0 为不额外等待
+ */
+#define SEG_BLANK_US           5
+
+/**
+ * @brief 亮度调节位数（0~4），亮度共 2^SEG_BRIGHTNESS_BITS 级
+ * @details 用二进制码调制（BCM）实现：每位的扫描时隙按 1:2:4:8 分成 SEG_BRIGHTNESS_BITS 段，
+ *          每段 1 次中断，亮度值的第 n 位决定第 n 段是否点亮；0 为不调节（每位 1 次中断，始终全亮）
+ * @note 最短的一段（SEG_SLOT_US / (2^SEG_BRIGHTNESS_BITS - 1)）必须长于 1 次中断的耗时（约 100 个机器周期 + 每次刷新的耗时），
+ *       例如直接驱动、4 位（16 级）时需 SEG_REFRESH_HZ <= 65；74HC595 驱动、100 Hz 时最多 2 位
+ */
+#define SEG_BRIGHTNESS_BITS    3
+
+/**
+ * @brief 是否编译 segment_set_float_number()（0-不编译，1-编译）
+ * @note 浮点显示会链接 C51 浮点运算库（数 KB 代码），不需要时保持为 0，改用 segment_set_fixed_number()
+ */
+#define SEG_FLOAT_SUPPORT      0
+
+/**
+ * @brief 滚动显示的最大字符数（0~64，0 为不支持滚动显示）
+ * @note 滚动缓冲区位于 idata，占用 SEG_SCROLL_TEXT_MAX + 2 * SEG_DIGIT_COUNT 字节
+ */
+#define SEG_SCROLL_TEXT_MAX    24
+
+/** @brief 滚动显示每移动 1 位的时间，单位：毫秒 (ms)（对应的帧数需在 1~255 之间） */
+#define SEG_SCROLL_MS          300
+
+/**
+ * @brief 闪烁属性的半周期（点亮与熄灭各持续的时间），单位：毫秒 (ms)（0 为不支持闪烁属性）
+ * @details 由 Timer0 中断按帧计数切换相位，主循环不需要改写显示缓冲区；对应的帧数需在 1~255 之间
+ */
+#define SEG_BLINK_MS           250
+
+/** @brief 每位的扫描时隙，单位：微秒 (us)（由上方参数计算得出，不要修改） */
+#define SEG_SLOT_US            (1000000UL / SEG_REFRESH_HZ / SEG_DIGIT_COUNT)
+
+/** @brief 最大亮度值（由上方参数计算得出，不要修改） */
+#define SEG_BRIGHTNESS_MAX     ((1 << SEG_BRIGHTNESS_BITS) - 1)
+
 #endif  /* _SEGMENT_CONFIGURATION_H_ */
\ No newline at end of file
@@ -0,0 +1,53 @@
+/**
+ * @file    spi_configuration.h
+ * @brief   SPI 软件模拟（主机）参数配置文件
+ * @version 1.0.0
+ * @author  ForeverMySunyu
+ * @date    2026-10-18
+ *
+ * @details
+ * 本文件用于统一配置软件 SPI 主机所使用的 IO 口及 SPI 模式。
+ *
+ * @note
+ *  - SPI 模式（CPOL/CPHA）在编译时确定，spi_hal.c 按所选模式生成完全展开的字节收发代码，
+ *    位循环内没有模式判断与分支
+ *  - 不插入任何时序延时，SCLK 以 MCU 能达到的最高速度翻转，
+ *    各晶振下的估算速率见 spi_hal.h；从机最高时钟低于该速率时不要使用本驱动
+ */
+
+#ifndef _SPI_CONFIGURATION_H_
+#define _SPI_CONFIGURATION_H_
+
+#include "../core/stc89.h"
+#include "osc_configuration.h"
+
+/*==================== SPI 引脚配置 ====================*/
+
+#define SPI_SCLK        P1^7        //! SPI 时钟线 SCLK
+#define SPI_MOSI        P1^5        //! SPI 主机输出线 MOSI
+#define SPI_MISO        P1^6        //! SPI 主机输入线 MISO
+#define SPI_CS          P1^4        //! SPI 片选线 CS（低电平有效）
+
+/*==================== SPI 模式配置 ====================*/
+/**
+ * | SPI_MODE | CPOL（空闲电平） | CPHA（采样沿） |          常见器件           |
+ * | :------: | :--------------: | :------------: | :-------------------------: |
+ * |    0     |        0         |  第 1 个边沿   | W25Qxx、74HC595、多数器件   |
+ * |    1     |        0         |  第 2 个边沿   |                             |
+ * |    2     |        1         |  第 1 个边沿   |                             |
+ * |    3     |        1         |  第 2 个边沿   | W25Qxx（也支持模式 3）      |
+ */
+#define SPI_MODE        0           //! SPI 模式（0~3）
+
+#if (SPI_MODE < 0) || (SPI_MODE > 3)
+#error "SPI_MODE must be between 0 and 3"
+#endif
+
+#define SPI_CPOL        ((SPI_MODE >> 1) & 0x01)    //! 时钟极性：SCLK 空闲电平
+#define SPI_CPHA        (SPI_MODE & 0x01)           //! 时钟相位：0-第 1 个边沿采样，1-第 2 个边沿采样
+
+/*==================== 数据配置 ====================*/
+
+#define SPI_DUMMY_BYTE  0xFF        //! 只读操作时 MOSI 上发送的填充字节
+
+#endif      /* _SPI_CONFIGURATION_H_ */
@@ -2,9 +2,9 @@
  ********************************************************************************************
  * @file    timer_configuration.h
  * @brief   51单片机定时器配置文件 — 适用于 STC89C516RD+ 型号单片机并兼容 STC89 系列单片机
- * @version 1.0.0
+ * @version 1.1.0
  * @author  ForeverMySunyu
- * @date    2025-12-15
+ * @date    2026-10-18
  ********************************************************************************************
 */
 
@@ -14,10 +14,11 @@
 #include "osc_configuration.h"
 #include "uart_configuration.h"
 #include "ind_key_configuration.h"
+#include "segment_configuration.h"
 
 
 /* ============================== Timer0 相关配置 ============================== */
-/* ====================== Timer0 用于定时50us并产生中断，进入中断服务程序 ====================== */
+/* ====================== Timer0 用于数码管动态扫描，每个中断刷新 1 位 ====================== */
 
 /**
  * @def TIMER0_MS
@@ -28,8 +29,9 @@
  *       模式1：65536*TIMER0_COUNT_RATE/FOSC_MHZ
  *       模式2：256*TIMER0_COUNT_RATE/FOSC_MHZ
  *       模式3：256*TIMER0_COUNT_RATE/FOSC_MHZ
+ * @note 等于数码管每位的扫描时隙，由 segment_configuration.h 中的 SEG_REFRESH_HZ 决定，不要单独修改
  */
-#define TIMER0_US       50
+#define TIMER0_US       SEG_SLOT_US
 
 /**
  * @def TIMER0_COUNT_RATE
@@ -67,7 +69,16 @@
  *       TL0 在 Timer0 相关配置中进行配置
  *       TH0 在 Timer1 相关配置中进行配置（此时限定为定时器功能，仅可配置定时时间 TIMER1_US）
  */
-#define TIMER0_MODE       0
+#define TIMER0_MODE       1
+
+/**
+ * @def TIMER0_ISR_PROFILE
+ * @brief 是否统计定时器0中断的耗时
+ * @details 值：0 - 不统计
+ *              1 - 统计从定时器溢出到回调函数返回的计数值（12T 模式下即机器周期数），
+ *                  由 timer0_get_isr_cycles() 读取最大值（仅支持模式1）
+ */
+#define TIMER0_ISR_PROFILE      1
 
 
 /* ============================== Timer1 相关配置 ============================== */
@@ -175,4 +186,33 @@
  */
 #define TIMER2_DCEN       0
 
+/**
+ * @def TIMER2_CALLBACK_NUM
+ * @brief 定时器2中断回调函数表容量
+ * @details 按键扫描、软件定时器等模块各占 1 个
+ */
+#define TIMER2_CALLBACK_NUM     4
+
+
+/* ============================== 软件定时器相关配置 ============================== */
+/* ====================== 软件定时器以 Timer2 中断为节拍（节拍周期 = TIMER2_US） ====================== */
+
+/**
+ * @def SOFT_TIMER_TICK_MS
+ * @brief 软件定时器节拍周期，单位：毫秒 (ms)
+ * @note 由 Timer2 定时时间决定，不要单独修改
+ */
+#define SOFT_TIMER_TICK_MS      (TIMER2_US/1000)
+
+/**
+ * @def SOFT_TIMER_NUM
+ * @brief 软件定时器个数（1~8）
+ * @details 各模块使用的定时器编号在下方统一分配，避免冲突
+ */
+#define SOFT_TIMER_NUM          4
+
+#define SOFT_TIMER_ID_DS18B20   0       //! DS18B20 温度转换等待
+#define SOFT_TIMER_ID_EEPROM_CACHE  1   //! EEPROM 页缓存自动刷新
+#define SOFT_TIMER_ID_EEPROM_ASYNC  2   //! EEPROM 异步写入写周期超时
+
 #endif /* _TIMER_CONFIGURATION_H_ */
\ No newline at end of file
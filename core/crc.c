@@ -0,0 +1,49 @@
+/**
+ ******************************************************************************************************************
+ * @file    crc.c
+ * @brief   51单片机 core 层 CRC 校验源文件 — 适用于 STC89C516RD+ 型号单片机并兼容 STC89 系列单片机
+ * @version 1.0.0
+ * @author  ForeverMySunyu
+ * @date    2026-10-18
+ *
+ * @details
+ *  - 半字节查表：比逐位计算快约 4 倍，比 256 项字节表少占 480 字节 ROM
+ ******************************************************************************************************************
+*/
+
+#include "crc.h"
+
+/* =========================== CRC 查表 =========================== */
+
+//! crc16_nibble_table[i] = 4 位数据 i 左移进 CRC 高 4 位后的余式
+static const uint16_t code crc16_nibble_table[16] =
+{
+    0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50A5, 0x60C6, 0x70E7,
+    0x8108, 0x9129, 0xA14A, 0xB16B, 0xC18C, 0xD1AD, 0xE1CE, 0xF1EF
+};
+
+/* =========================== CRC 接口函数 =========================== */
+
+/**
+ * @brief 计算 CRC-16/CCITT
+ * @param crc 初值：第一段传入 CRC16_CCITT_INIT，分段计算时传入上一段的结果
+ * @param buf 指向数据
+ * @param length 字节数
+ * @return CRC 值
+ */
+uint16_t crc16_ccitt(uint16_t crc, const uint8_t *buf, uint16_t length)
+{
+    uint8_t byte;
+
+    while (length--)
+    {
+        byte = *buf++;
+
+        /* 高 4 位 */
+        crc = (crc << 4) ^ crc16_nibble_table[(uint8_t)(crc >> 12) ^ (byte >> 4)];
+        /* 低 4 位 */
+        crc = (crc << 4) ^ crc16_nibble_table[(uint8_t)(crc >> 12) ^ (byte & 0x0F)];
+    }
+
+    return crc;
+}
@@ -0,0 +1,27 @@
+/**
+ ******************************************************************************************************************
+ * @file    crc.h
+ * @brief   51单片机 core 层 CRC 校验头文件 — 适用于 STC89C516RD+ 型号单片机并兼容 STC89 系列单片机
+ * @version 1.0.0
+ * @author  ForeverMySunyu
+ * @date    2026-10-18
+ *
+ * @details
+ *  - CRC-16/CCITT-FALSE：多项式 0x1021，初值 0xFFFF，高位先计算，不取反
+ *  - 以 4 位为单位查表（16 项表格位于 code 区，只占 32 字节 ROM），每字节 2 次查表
+ *  - 支持分段计算：第一段传入 CRC16_CCITT_INIT，之后每段传入上一段的结果
+ *    例如 "123456789" 的校验值为 0x29B1
+ ******************************************************************************************************************
+*/
+
+#ifndef _CRC_H_
+#define _CRC_H_
+
+#include <stdint.h>
+
+#define CRC16_CCITT_INIT    0xFFFF      //! CRC-16/CCITT 初值
+
+/* ===================== CRC 接口函数声明区 ======================== */
+uint16_t crc16_ccitt(uint16_t crc, const uint8_t *buf, uint16_t length);    //! 计算 CRC-16/CCITT（可分段）
+
+#endif  /* _CRC_H_ */
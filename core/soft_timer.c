@@ -0,0 +1,175 @@
+/**
+ ******************************************************************************************************************
+ * @file    soft_timer.c
+ * @brief   51单片机 core 层软件定时器源文件 — 适用于 STC89C516RD+ 型号单片机并兼容 STC89 系列单片机
+ * @version 1.0.0
+ * @author  ForeverMySunyu
+ * @date    2026-10-18
+ *
+ * @details
+ *  - 中断中只对正在计时的定时器做 16 位递减，到期时置位 1 字节的到期标志
+ *  - 主循环查询只读取 1 字节标志（单条指令，天然原子），修改 16 位计数时短暂关闭 T2 中断
+ ******************************************************************************************************************
+*/
+
+#include "soft_timer.h"
+#include "timer.h"
+#include "stc89.h"
+#include "../config/timer_configuration.h"
+
+#if (SOFT_TIMER_NUM < 1) || (SOFT_TIMER_NUM > 8)
+    #error "SOFT_TIMER_NUM must be between 1 and 8"
+#endif
+
+/* =========================== 软件定时器状态 =========================== */
+
+static uint16_t soft_timer_count[SOFT_TIMER_NUM];       //! 各定时器剩余节拍数
+static uint8_t soft_timer_run_mask = 0;                 //! 正在计时的定时器（按位）
+static uint8_t soft_timer_expired_mask = 0;             //! 已到期的定时器（按位）
+static uint16_t soft_timer_tick_count = 0;              //! 自由运行节拍计数
+
+/* =========================== 内部函数声明区 =========================== */
+
+static void soft_timer_tick(void);
+
+/* =========================== 软件定时器接口函数 =========================== */
+
+/**
+ * @brief 软件定时器初始化
+ * @note 向 Timer2 注册节拍回调，所有定时器处于停止状态
+ * @param None
+ * @return None
+ */
+void soft_timer_init(void)
+{
+    soft_timer_run_mask = 0;
+    soft_timer_expired_mask = 0;
+
+    timer2_register_callback(soft_timer_tick);
+}
+
+/**
+ * @brief 启动（或重新启动）定时器
+ * @param id 定时器编号（0 ~ SOFT_TIMER_NUM-1）
+ * @param ms 定时时间（ms），向上取整到 SOFT_TIMER_TICK_MS 的整数倍，为 0 时立即到期
+ * @return None
+ */
+void soft_timer_start(uint8_t id, uint16_t ms)
+{
+    uint16_t ticks = (ms + SOFT_TIMER_TICK_MS - 1) / SOFT_TIMER_TICK_MS;
+    uint8_t mask = (uint8_t)(0x01 << id);
+    bit et2_save;
+
+    if (id >= SOFT_TIMER_NUM)   return;
+
+    et2_save = ET2;
+    ET2 = 0;
+
+    if (ticks)
+    {
+        soft_timer_count[id] = ticks;
+        soft_timer_run_mask |= mask;
+        soft_timer_expired_mask &= ~mask;
+    }
+    else
+    {
+        soft_timer_run_mask &= ~mask;
+        soft_timer_expired_mask |= mask;
+    }
+
+    ET2 = et2_save;
+}
+
+/**
+ * @brief 停止定时器
+ * @param id 定时器编号（0 ~ SOFT_TIMER_NUM-1）
+ * @return None
+ */
+void soft_timer_stop(uint8_t id)
+{
+    uint8_t mask = (uint8_t)(0x01 << id);
+    bit et2_save;
+
+    if (id >= SOFT_TIMER_NUM)   return;
+
+    et2_save = ET2;
+    ET2 = 0;
+
+    soft_timer_run_mask &= ~mask;
+    soft_timer_expired_mask &= ~mask;
+
+    ET2 = et2_save;
+}
+
+/**
+ * @brief 查询定时器是否已到期
+ * @note 到期状态保持到下一次 soft_timer_start() 或 soft_timer_stop()
+ * @param id 定时器编号（0 ~ SOFT_TIMER_NUM-1）
+ * @return 1-已到期，0-未到期（或未启动）
+ */
+bool soft_timer_expired(uint8_t id)
+{
+    if (id >= SOFT_TIMER_NUM)   return 0;
+
+    return (soft_timer_expired_mask >> id) & 0x01;
+}
+
+/**
+ * @brief 查询定时器是否正在计时
+ * @param id 定时器编号（0 ~ SOFT_TIMER_NUM-1）
+ * @return 1-正在计时，0-已停止或已到期
+ */
+bool soft_timer_running(uint8_t id)
+{
+    if (id >= SOFT_TIMER_NUM)   return 0;
+
+    return (soft_timer_run_mask >> id) & 0x01;
+}
+
+/**
+ * @brief 读取自由运行的节拍计数
+ * @note 用差值计算经过的时间：(uint16_t)(soft_timer_ticks() - start) * SOFT_TIMER_TICK_MS
+ * @param None
+ * @return 节拍计数
+ */
+uint16_t soft_timer_ticks(void)
+{
+    uint16_t ticks;
+    bit et2_save;
+
+    et2_save = ET2;
+    ET2 = 0;
+    ticks = soft_timer_tick_count;
+    ET2 = et2_save;
+
+    return ticks;
+}
+
+/* =========================== 内部函数定义区 =========================== */
+
+/**
+ * @brief 软件定时器节拍处理
+ * @note 在 Timer2 中断中以 SOFT_TIMER_TICK_MS 为周期调用
+ * @param None
+ * @return None
+ */
+static void soft_timer_tick(void)
+{
+    uint8_t i;
+    uint8_t mask = 0x01;
+
+    soft_timer_tick_count ++;
+
+    if (!soft_timer_run_mask)   return;
+
+    for (i = 0; i < SOFT_TIMER_NUM; i++)
+    {
+        if ((soft_timer_run_mask & mask) && (--soft_timer_count[i] == 0))
+        {
+            soft_timer_run_mask &= ~mask;
+            soft_timer_expired_mask |= mask;
+        }
+
+        mask <<= 1;
+    }
+}
@@ -0,0 +1,32 @@
+/**
+ ******************************************************************************************************************
+ * @file    soft_timer.h
+ * @brief   51单片机 core 层软件定时器头文件 — 适用于 STC89C516RD+ 型号单片机并兼容 STC89 系列单片机
+ * @version 1.0.0
+ * @author  ForeverMySunyu
+ * @date    2026-10-18
+ *
+ * @details
+ *  - 以 Timer2 中断为节拍（SOFT_TIMER_TICK_MS），提供 SOFT_TIMER_NUM 个单次倒计时定时器
+ *  - 用于替代长时间的阻塞延时：启动定时器后主循环继续运行，之后查询是否到期
+ *  - 定时器编号在 timer_configuration.h 中统一分配
+ *  - 使用前需调用 soft_timer_init() 并初始化、启动 Timer2
+ ******************************************************************************************************************
+*/
+
+#ifndef _SOFT_TIMER_H_
+#define _SOFT_TIMER_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "../config/timer_configuration.h"
+
+/* ===================== 软件定时器接口函数声明区 ======================== */
+void soft_timer_init(void);                         //! 软件定时器初始化（向 Timer2 注册节拍回调）
+void soft_timer_start(uint8_t id, uint16_t ms);     //! 启动（或重新启动）定时器，ms 向上取整到节拍
+void soft_timer_stop(uint8_t id);                   //! 停止定时器（停止后查询结果为未到期）
+bool soft_timer_expired(uint8_t id);                //! 查询定时器是否已到期
+bool soft_timer_running(uint8_t id);                //! 查询定时器是否正在计时
+uint16_t soft_timer_ticks(void);                    //! 读取自由运行的节拍计数（每 SOFT_TIMER_TICK_MS 加 1，溢出回绕）
+
+#endif  /* _SOFT_TIMER_H_ */
@@ -2,9 +2,9 @@
  ******************************************************************************************************************
  * @file    timer.c
  * @brief   51单片机 core 层定时器初始化及中断服务程序源文件 — 适用于 STC89C516RD+ 型号单片机并兼容 STC89 系列单片机
- * @version 1.2.0
+ * @version 1.5.1
  * @author  ForeverMySunyu
- * @date    2025-12-17
+ * @date    2026-10-18
  ******************************************************************************************************************
 */
 
@@ -29,6 +29,12 @@
     #error "The setting of TIMER0_MODE is incorrect."
 #endif
 
+#if TIMER0_MODE != 1
+    #error "Timer0 drives the segment display and must use TIMER0_MODE 1."
+#endif
+
+#define TIMER0_PERIOD   (uint16_t)(0 - TIMER0_VALUE)        //! 定时器0一个周期的计数值（回调未注册时使用）
+
 /* ==================== Timer1 相关参数计算（根据 timer_configuration.h 中参数自动计算得出，不要轻易修改） ==================== */
 #if TIMER1_MODE == 0
     #define TIMER1_VALUE    (uint16_t)((8192-FOSC_MHZ*TIMER1_US/TIMER1_COUNT_RATE)+0.5)
@@ -49,7 +55,7 @@
 
 /**
  * @brief 定时器0初始化函数
- * @note Timer0 用于定时50us并产生中断，进入中断服务程序
+ * @note Timer0 用于数码管动态扫描，定时 TIMER0_US 并产生中断（高优先级）
  * @param None
  * @return None
  */
@@ -101,7 +107,8 @@ void Timer0_Init(void)
     #else
         TF0 = 0;            //! T0 溢出中断标志清零
 
-        ET0 = 1;            //! 开 T2 中断
+        PT0 = 1;            //! T0 设为高优先级，刷新不被其他中断中的长回调推迟
+        ET0 = 1;            //! 开 T0 中断
 
         TR0 = 1;            //! 启动 T0
 
@@ -196,22 +203,85 @@ void Timer2_Init(void)
     ET2 = 1;
 
     //! 启动 T2
-    TR1 = 1;
+    TR2 = 1;
 }
 
 /* =========================== 回调函数定义与注册 =========================== */
 
-static Timer2_Routine_Callback_t timer2_routine_callback = NULL;            //! 定时器2中断回调函数指针，保存由上层（HAL）注册的回调接口
+static Timer0_Routine_Callback_t timer0_routine_callback = NULL;                    //! 定时器0中断回调函数指针，由上层（HAL）注册
+
+#if TIMER0_ISR_PROFILE
+    static uint16_t timer0_isr_cycles_max = 0;                                      //! 定时器0中断耗时最大值（计数值）
+#endif
+
+/**
+ * @brief 定时器0中断服务程序中的回调函数注册接口
+ * @note 只有 1 个回调，重复注册时替换为新的回调函数；
+ *       回调的返回值为本次溢出到下次溢出的计数值（12T 模式下即机器周期），每次中断可以不同
+ * @param cb 回调函数指针
+ * @return None
+ */
+void timer0_register_callback(Timer0_Routine_Callback_t cb)
+{
+    bit et0_save;
+
+    et0_save = ET0;
+    ET0 = 0;            //! 注册期间关 T0 中断，避免中断读到未写完的函数指针
+    timer0_routine_callback = cb;
+    ET0 = et0_save;
+}
+
+/**
+ * @brief 读取并清零定时器0中断耗时的最大值
+ * @note 耗时从定时器溢出开始计算（包含中断响应延迟），到回调函数返回并重装初值为止，不包含现场恢复与 RETI（约 30 个机器周期）
+ * @param None
+ * @return 上次读取以来单次中断的最大耗时（计数值，12T 模式下即机器周期）；TIMER0_ISR_PROFILE 为 0 时返回 0
+ */
+uint16_t timer0_get_isr_cycles(void)
+{
+    uint16_t cycles = 0;
+
+    #if TIMER0_ISR_PROFILE
+        bit et0_save;
+
+        et0_save = ET0;
+        ET0 = 0;
+        cycles = timer0_isr_cycles_max;
+        timer0_isr_cycles_max = 0;
+        ET0 = et0_save;
+    #endif
+
+    return cycles;
+}
+
+static Timer2_Routine_Callback_t timer2_routine_callback[TIMER2_CALLBACK_NUM];     //! 定时器2中断回调函数指针表，保存由上层（HAL）注册的回调接口
+static uint8_t timer2_callback_count = 0;                                           //! 已注册的回调函数个数
 
 /**
  * @brief 定时器2中断服务程序中的回调函数注册接口
- * @note 供上层（HAL）调用注册
+ * @note 供上层（HAL）调用注册，回调表已满或该函数已注册时忽略本次注册
  * @param cb 回调函数指针
  * @return None
  */
 void timer2_register_callback(Timer2_Routine_Callback_t cb)
 {
-    timer2_routine_callback = cb;
+    uint8_t i;
+    bit et2_save;
+
+    if (cb == NULL)     return;
+
+    for (i = 0; i < timer2_callback_count; i++)
+    {
+        if (timer2_routine_callback[i] == cb)   return;
+    }
+
+    if (timer2_callback_count >= TIMER2_CALLBACK_NUM)   return;
+
+    et2_save = ET2;
+    ET2 = 0;            //! 注册期间关 T2 中断，避免中断读到未写完的表项
+    timer2_routine_callback[timer2_callback_count] = cb;
+    timer2_callback_count ++;
+    ET2 = et2_save;
 }
 
 
@@ -220,13 +290,32 @@ void timer2_register_callback(Timer2_Routine_Callback_t cb)
 
 /**
  * @brief 定时器0中断服务程序
- * @note Timer0 用于定时50us并产生中断，进入该中断服务程序
+ * @note Timer0 用于数码管动态扫描，调用已注册的回调函数后按回调给出的周期重装初值
  * @param None
  * @return None
  */
 void Timer0_Routine(void) interrupt 1
 {
+    uint16_t period = TIMER0_PERIOD;
+    uint16_t count;
 
+    if (timer0_routine_callback != NULL)
+    {
+        period = timer0_routine_callback();         //! 回调先执行（端口输出的抖动最小），并给出本周期的长度（覆盖分析见 timer.h）
+    }
+
+    //! 模式1 无自动重装：在溢出以来的计数值上加初值，中断响应与回调的耗时不会累积到周期中
+    TR0 = 0;
+    count = ((uint16_t)TH0 << 8) | TL0;
+
+    #if TIMER0_ISR_PROFILE
+        if (count > timer0_isr_cycles_max)      timer0_isr_cycles_max = count;
+    #endif
+
+    count -= period;
+    TL0 = (uint8_t)count;
+    TH0 = (uint8_t)(count >> 8);
+    TR0 = 1;
 }
 
 /**
@@ -242,14 +331,18 @@ void Timer1_Routine(void) interrupt 3
 
 /**
  * @brief 定时器2中断服务程序
- * @note Timer2 用于独立按键定时循环扫描
+ * @note Timer2 用于独立按键定时循环扫描与软件定时器节拍
  * @param None
  * @return None
  */
 void Timer2_Routine(void) interrupt 5
 {
-    if(timer2_routine_callback != NULL)
+    uint8_t i;
+
+    TF2 = 0;            //! T2 溢出标志需软件清零
+
+    for (i = 0; i < timer2_callback_count; i++)
     {
-        timer2_routine_callback();          //! 以回调函数形式调用独立按键检测程序
-    }    
+        timer2_routine_callback[i]();           //! 依次调用已注册的回调函数（独立按键检测、软件定时器等，覆盖分析见 timer.h）
+    }
 }
\ No newline at end of file
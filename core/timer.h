@@ -2,24 +2,51 @@
  ******************************************************************************************************************
  * @file    timer.h
  * @brief   51单片机 core 层定时器初始化及中断服务程序头文件 — 适用于 STC89C516RD+ 型号单片机并兼容 STC89 系列单片机
- * @version 1.2.0
+ * @version 1.5.1
  * @author  ForeverMySunyu
- * @date    2025-12-17
+ * @date    2026-10-18
  ******************************************************************************************************************
 */
 
 #ifndef _TIMER_H_
 #define _TIMER_H_
 
+#include "stdint.h"
+
 /* ===================== 定时器初始化函数声明区 ======================== */
 void Timer0_Init(void);         //! 定时器0初始化函数
 void Timer1_Init(void);         //! 定时器1初始化函数
 void Timer2_Init(void);         //! 定时器2初始化函数
 
+/* ===================== 定义回调函数类型（定时器0中断服务程序） ======================== */
+typedef uint16_t (*Timer0_Routine_Callback_t)(void);       //! 返回值：到下次中断的计数值
+
 /* ===================== 定义回调函数类型（定时器2中断服务程序） ======================== */
 typedef void (*Timer2_Routine_Callback_t)(void);
 
 /* ===================== 注册回调函数接口（供HAL层调用） ===================== */
+/**
+ * @attention 回调经函数指针在中断中调用，Keil 的覆盖分析看不到这一调用关系，会把回调当作注册函数（主循环）调用的函数，
+ *            其局部变量可能与主循环中的函数重叠；工程的链接器 OVERLAY 选项（Options - LX51 Misc - Overlay）已把现有回调
+ *            移到中断的调用树中：
+ *            segment_init_hal ~ segment_scan, Timer0_Routine ! segment_scan,
+ *            key_init_hal ~ key_scan, soft_timer_init ~ soft_timer_tick, Timer2_Routine ! (key_scan, soft_timer_tick)
+ *            新增回调时按同样格式添加（注册函数 ~ 回调，中断服务程序 ! 回调）
+ */
+
+/**
+ * @note 定时器0中断只调用 1 个回调（数码管动态扫描），回调返回到下次中断的计数值，用于不等长的时隙；
+ *       回调应尽量短，每次中断的耗时可由 timer0_get_isr_cycles() 读取
+ */
+void timer0_register_callback(Timer0_Routine_Callback_t cb);
+
+/**
+ * @note 定时器2中断中按注册顺序依次调用全部回调（最多 TIMER2_CALLBACK_NUM 个），
+ *       按键扫描与软件定时器等模块可以同时注册；重复注册同一函数只保留一份
+ */
 void timer2_register_callback(Timer2_Routine_Callback_t cb);
 
+/* ===================== 中断耗时统计接口 ===================== */
+uint16_t timer0_get_isr_cycles(void);     //! 读取并清零定时器0中断耗时的最大值（计数值）
+
 #endif
\ No newline at end of file
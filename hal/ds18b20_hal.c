@@ -0,0 +1,127 @@
+/**
+ * @file    ds18b20_hal.c
+ * @brief   DS18B20 温度传感器 hal 实现
+ * @version 1.0.0
+ * @author  ForeverMySunyu
+ * @date    2026-10-18
+ *
+ * @details
+ *  - 转换等待不再阻塞 750ms：启动转换后以软件定时器计时，到期前读取返回 ONEWIRE_ERR_BUSY
+ *  - 读取暂存器时校验 CRC8，避免把线路干扰读成错误温度
+ */
+
+#include <stddef.h>
+#include "../config/onewire_configuration.h"
+#include "../config/timer_configuration.h"
+#include "../core/soft_timer.h"
+#include "onewire_hal.h"
+#include "ds18b20_hal.h"
+
+/*==================== 配置寄存器 ====================*/
+
+//! 配置寄存器：R1 R0 位于 bit6 bit5，其余位固定为 1
+#define DS18B20_CONFIG_REG      ((uint8_t)(((DS18B20_RESOLUTION - 9) << 5) | 0x1F))
+
+#define DS18B20_SCRATCHPAD_SIZE 9       //! 暂存器长度（字节）
+
+/*==================== API 函数定义区域 ====================*/
+
+/**
+ * @brief DS18B20 初始化函数
+ * @note 初始化 1-Wire 总线，并以 SKIP ROM 为总线上全部 DS18B20 写入 DS18B20_RESOLUTION 分辨率
+ * @param None
+ * @return 1-Wire 状态
+ */
+onewire_states_t DS18B20_Init(void)
+{
+    if (OneWire_Init_hal() != ONEWIRE_OK)
+    {
+        return ONEWIRE_ERR_NO_PRESENCE;
+    }
+
+    if (OneWire_Select(NULL) != ONEWIRE_OK)
+    {
+        return ONEWIRE_ERR_NO_PRESENCE;
+    }
+
+    OneWire_WriteByte(DS18B20_CMD_WRITE_SCRATCHPAD);
+    OneWire_WriteByte(DS18B20_ALARM_TH);
+    OneWire_WriteByte(DS18B20_ALARM_TL);
+    OneWire_WriteByte(DS18B20_CONFIG_REG);
+
+    return ONEWIRE_OK;
+}
+
+/**
+ * @brief 启动温度转换（非阻塞）
+ * @note 发出 CONVERT T 命令后立即返回，并启动软件定时器计时 DS18B20_CONVERT_MS
+ * @param rom 器件 ROM 码，为 NULL 时同时启动总线上全部器件
+ * @return 1-Wire 状态
+ */
+onewire_states_t DS18B20_StartConvert(const uint8_t *rom)
+{
+    if (OneWire_Select(rom) != ONEWIRE_OK)
+    {
+        soft_timer_stop(SOFT_TIMER_ID_DS18B20);
+        return ONEWIRE_ERR_NO_PRESENCE;
+    }
+
+    OneWire_WriteByte(DS18B20_CMD_CONVERT_T);
+
+    soft_timer_start(SOFT_TIMER_ID_DS18B20, DS18B20_CONVERT_MS);
+
+    return ONEWIRE_OK;
+}
+
+/**
+ * @brief 查询温度转换时间是否已到
+ * @param None
+ * @return 1-转换已完成，可以读取；0-转换中或未启动
+ */
+bool DS18B20_ConvertDone(void)
+{
+    return soft_timer_expired(SOFT_TIMER_ID_DS18B20);
+}
+
+/**
+ * @brief 读取温度
+ * @param rom 器件 ROM 码，为 NULL 时使用 SKIP ROM（总线上只有 1 个器件）
+ * @param temp 用于保存温度的变量（单位：1/16 ℃）
+ * @return 1-Wire 状态
+ * @retval ONEWIRE_OK - 读取成功
+ *         ONEWIRE_ERR_BUSY - 转换时间未到
+ *         ONEWIRE_ERR_NO_PRESENCE - 器件无应答
+ *         ONEWIRE_ERR_CRC - 暂存器 CRC 校验失败
+ */
+onewire_states_t DS18B20_ReadTemp(const uint8_t *rom, int16_t *temp)
+{
+    uint8_t scratchpad[DS18B20_SCRATCHPAD_SIZE];
+    uint8_t i;
+
+    if (soft_timer_running(SOFT_TIMER_ID_DS18B20))
+    {
+        return ONEWIRE_ERR_BUSY;
+    }
+
+    if (OneWire_Select(rom) != ONEWIRE_OK)
+    {
+        return ONEWIRE_ERR_NO_PRESENCE;
+    }
+
+    OneWire_WriteByte(DS18B20_CMD_READ_SCRATCHPAD);
+    for (i = 0; i < DS18B20_SCRATCHPAD_SIZE; i++)
+    {
+        scratchpad[i] = OneWire_ReadByte();
+    }
+
+    if (OneWire_CRC8(scratchpad, DS18B20_SCRATCHPAD_SIZE) != 0)
+    {
+        return ONEWIRE_ERR_CRC;
+    }
+
+    /* 温度寄存器：低字节在前；低分辨率时未定义的低位清零 */
+    *temp = (int16_t)(((uint16_t)scratchpad[1] << 8) | scratchpad[0]);
+    *temp &= ~((1 << (12 - DS18B20_RESOLUTION)) - 1);
+
+    return ONEWIRE_OK;
+}
@@ -0,0 +1,54 @@
+/**
+ * @file    ds18b20_hal.h
+ * @brief   DS18B20 温度传感器 hal 接口
+ * @version 1.0.0
+ * @author  ForeverMySunyu
+ * @date    2026-10-18
+ *
+ * @details
+ *  - 温度转换为非阻塞方式：DS18B20_StartConvert() 发出转换命令后立即返回，
+ *    由软件定时器（SOFT_TIMER_ID_DS18B20）计时 DS18B20_CONVERT_MS，主循环在此期间继续运行
+ *  - 温度以 1/16 ℃ 为单位的 int16_t 返回（DS18B20 原始格式），例如 25.0625 ℃ 返回 401
+ *  - rom 参数为 NULL 时使用 SKIP ROM（总线上只有 1 个器件，或同时启动全部器件的转换）
+ *
+ * @attention 使用前需调用 soft_timer_init()，并初始化、启动 Timer2
+ *
+ * @code{.c}
+ * DS18B20_Init();
+ * DS18B20_StartConvert(NULL);              // 启动全部器件的转换
+ * while (1)
+ * {
+ *     if (DS18B20_ConvertDone())
+ *     {
+ *         DS18B20_ReadTemp(rom, &temp);    // 读取某个器件的结果
+ *         DS18B20_StartConvert(NULL);      // 启动下一次转换
+ *     }
+ *     // ... 其他任务 ...
+ * }
+ * @endcode
+ */
+
+#ifndef _DS18B20_HAL_H_
+#define _DS18B20_HAL_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "../config/onewire_configuration.h"
+#include "onewire_hal.h"
+
+/*==================== DS18B20 功能命令 ====================*/
+
+#define DS18B20_CMD_CONVERT_T           0x44    //! 启动温度转换
+#define DS18B20_CMD_WRITE_SCRATCHPAD    0x4E    //! 写暂存器（TH、TL、配置寄存器）
+#define DS18B20_CMD_READ_SCRATCHPAD     0xBE    //! 读暂存器（9 字节，含 CRC）
+
+#define DS18B20_FAMILY_CODE             0x28    //! DS18B20 家族码（ROM 码第 0 字节）
+
+/*==================== API 函数声明区域 ====================*/
+
+onewire_states_t DS18B20_Init(void);                                    //! 初始化总线，并为全部器件写入分辨率配置
+onewire_states_t DS18B20_StartConvert(const uint8_t *rom);              //! 启动温度转换（非阻塞）
+bool DS18B20_ConvertDone(void);                                         //! 查询温度转换时间是否已到
+onewire_states_t DS18B20_ReadTemp(const uint8_t *rom, int16_t *temp);   //! 读取温度（单位：1/16 ℃）
+
+#endif  /* _DS18B20_HAL_H_ */
@@ -0,0 +1,285 @@
+/**
+ * @file    eeprom_async_hal.c
+ * @brief   EEPROM 异步（非阻塞）写入 HAL 源文件
+ * @author  ForeverMySunyu
+ * @version 1.0.3
+ * @date    2026-10-18
+ *
+ * @details
+ *  - 队列非空时，队首请求总有 1 页已经发出、正在等待写周期完成（eeprom_async_pending）
+ *  - 回调函数中可以再次调用 EEPROM_Async_Write()：回调期间提交的请求只加入队列，
+ *    由调用回调的一方在回调返回后发出，不会嵌套调用 EEPROM_Async_Start() / EEPROM_Async_Finish()
+ *  - 队首请求的当前页：地址 job->addr，长度为到页边界和剩余字节数中较小者
+ *  - ACK 探测每个软件定时器节拍（SOFT_TIMER_TICK_MS）最多 1 次，发出页的节拍内不探测，写周期中不持续占用总线
+ */
+
+#include <stddef.h>
+#include "../config/eeprom_configuration.h"
+#include "../config/timer_configuration.h"
+#include "../core/soft_timer.h"
+#include "eeprom_hal.h"
+#include "eeprom_async_hal.h"
+
+/* ========================= 写入队列 ========================= */
+
+typedef struct
+{
+    uint16_t addr;                      //! 当前页的起始地址
+    uint8_t *buf;                       //! 当前页数据
+    uint16_t length;                    //! 剩余字节数（含当前页）
+    EEPROM_Async_Callback_T callback;   //! 完成回调函数
+} EEPROM_Async_Job_T;
+
+static EEPROM_Async_Job_T xdata eeprom_async_queue[EEPROM_ASYNC_QUEUE_LEN];    //! 写入队列
+static uint8_t eeprom_async_head = 0;                                           //! 队首下标
+static uint8_t eeprom_async_count = 0;                                          //! 队列中的请求数
+static bool eeprom_async_pending = 0;                                           //! 队首请求已有 1 页发出、正在等待写周期
+static bool eeprom_async_in_callback = 0;                                       //! 正在执行完成回调函数
+static uint16_t eeprom_async_probe_tick = 0;                                    //! 上次发出页或 ACK 探测时的节拍计数
+
+/* ========================= 内部函数声明区域 ========================= */
+
+static uint8_t EEPROM_Async_PageLength(EEPROM_Async_Job_T xdata *job);
+static void EEPROM_Async_Start(void);
+static void EEPROM_Async_PageDone(void);
+static void EEPROM_Async_Finish(EEPROM_Error_T result);
+
+/* ========================= API 函数定义区域 ========================= */
+
+/**
+ * @brief 异步写入初始化（清空队列）
+ * @param None
+ * @return None
+ */
+void EEPROM_Async_Init(void)
+{
+    eeprom_async_head = 0;
+    eeprom_async_count = 0;
+    eeprom_async_pending = 0;
+
+    soft_timer_stop(SOFT_TIMER_ID_EEPROM_ASYNC);
+}
+
+/**
+ * @brief 提交异步写入请求
+ * @note 队列原本为空时第一页在本函数内发出
+ * @param addr EEPROM 内部数据地址（起始存储地址）
+ * @param buf 1 个指针，指向：存放要写入数据的变量（完成前保持不变）
+ * @param length 要写入的字节数
+ * @param callback 完成回调函数，可为 NULL
+ * @return EEPROM 驱动程序错误码
+ */
+EEPROM_Error_T EEPROM_Async_Write(uint16_t addr, uint8_t *buf, uint16_t length, EEPROM_Async_Callback_T callback)
+{
+    EEPROM_Async_Job_T xdata *job;
+
+    /* ===================== 参数检查 ===================== */
+
+    if ((length == 0) || ((uint32_t)addr + length > EEPROM_SIZE_BYTES))
+    {
+        return EEPROM_ERR_DATA_SIZE;
+    }
+
+    if (eeprom_async_count >= EEPROM_ASYNC_QUEUE_LEN)
+    {
+        return EEPROM_ERR_SLAVE_BUSY;
+    }
+
+    /* ===================== 加入队尾 ===================== */
+
+    job = &eeprom_async_queue[(eeprom_async_head + eeprom_async_count) % EEPROM_ASYNC_QUEUE_LEN];
+    job->addr = addr;
+    job->buf = buf;
+    job->length = length;
+    job->callback = callback;
+
+    eeprom_async_count ++;
+
+    /* 没有页在等待写周期（队列原本为空）时立即发出第一页；回调中提交时由回调的调用方发出 */
+    if (!eeprom_async_in_callback)
+    {
+        EEPROM_Async_Start();
+    }
+
+    return EEPROM_OK;
+}
+
+/**
+ * @brief 异步写入后台任务（在主循环中周期性调用）
+ * @note 每个软件定时器节拍最多 1 次 ACK 探测（同一节拍内的其他调用直接返回）；写周期完成后发出下一页
+ * @param None
+ * @return None
+ */
+void EEPROM_Async_Task(void)
+{
+    EEPROM_Error_T eeprom_error;
+    uint16_t tick;
+
+    if (eeprom_async_count == 0)
+    {
+        return;
+    }
+
+    /* 限制探测频率：写周期期间其他器件仍可使用总线 */
+    tick = soft_timer_ticks();
+    if (tick == eeprom_async_probe_tick)
+    {
+        return;
+    }
+    eeprom_async_probe_tick = tick;
+
+    /* 器件应答：当前页写周期已完成 */
+    eeprom_error = EEPROM_AckProbe();
+    if (eeprom_error == EEPROM_OK)
+    {
+        EEPROM_Async_PageDone();
+        return;
+    }
+
+    /* 写周期超时：该请求失败（总线故障时报告 EEPROM_ERR_IIC），继续下一个请求 */
+    if (soft_timer_expired(SOFT_TIMER_ID_EEPROM_ASYNC))
+    {
+        eeprom_async_pending = 0;
+        EEPROM_Async_Finish((eeprom_error == EEPROM_ERR_IIC) ? EEPROM_ERR_IIC : EEPROM_ERR_TIMEOUT);
+        EEPROM_Async_Start();
+    }
+}
+
+/**
+ * @brief 查询是否有未完成的异步写入
+ * @param None
+ * @return 1-有，0-队列为空
+ */
+bool EEPROM_Async_Busy(void)
+{
+    return (eeprom_async_count != 0);
+}
+
+/**
+ * @brief 阻塞等待全部异步写入完成
+ * @note 以 EEPROM_AckPolling() 等待每一页的写周期
+ * @param None
+ * @return None
+ */
+void EEPROM_Async_Flush(void)
+{
+    EEPROM_Error_T eeprom_error;
+
+    while (eeprom_async_count)
+    {
+        eeprom_error = EEPROM_AckPolling();
+        if (eeprom_error == EEPROM_OK)
+        {
+            EEPROM_Async_PageDone();
+        }
+        else
+        {
+            eeprom_async_pending = 0;
+            EEPROM_Async_Finish((eeprom_error == EEPROM_ERR_IIC) ? EEPROM_ERR_IIC : EEPROM_ERR_TIMEOUT);
+            EEPROM_Async_Start();
+        }
+    }
+}
+
+/* ========================= 内部函数定义区域 ========================= */
+
+/**
+ * @brief 计算请求当前页的字节数（不超过页边界）
+ * @param job 请求
+ * @return 当前页的字节数
+ */
+static uint8_t EEPROM_Async_PageLength(EEPROM_Async_Job_T xdata *job)
+{
+    uint8_t page_length = EEPROM_PAGE_SIZE - (job->addr % EEPROM_PAGE_SIZE);
+
+    if (page_length > job->length)
+    {
+        page_length = job->length;
+    }
+
+    return page_length;
+}
+
+/**
+ * @brief 发出队首请求的当前页（已有页在等待写周期时不做任何事）
+ * @note 发送失败的请求以错误码结束，并继续尝试下一个请求，直到有 1 页成功发出或队列为空
+ * @param None
+ * @return None
+ */
+static void EEPROM_Async_Start(void)
+{
+    EEPROM_Async_Job_T xdata *job;
+    EEPROM_Error_T eeprom_error;
+
+    if (eeprom_async_pending)
+    {
+        return;
+    }
+
+    while (eeprom_async_count && !eeprom_async_pending)
+    {
+        job = &eeprom_async_queue[eeprom_async_head];
+
+        eeprom_error = EEPROM_PageSend(job->addr / EEPROM_PAGE_SIZE, job->addr % EEPROM_PAGE_SIZE,
+                                       job->buf, EEPROM_Async_PageLength(job));
+        if (eeprom_error == EEPROM_OK)
+        {
+            eeprom_async_pending = 1;
+            eeprom_async_probe_tick = soft_timer_ticks();       //! 发出页的节拍内不探测
+            soft_timer_start(SOFT_TIMER_ID_EEPROM_ASYNC, EEPROM_ASYNC_TIMEOUT_MS);
+            return;
+        }
+
+        EEPROM_Async_Finish(eeprom_error);
+    }
+}
+
+/**
+ * @brief 当前页写周期完成：推进到下一页，或结束请求并开始下一个请求
+ * @param None
+ * @return None
+ */
+static void EEPROM_Async_PageDone(void)
+{
+    EEPROM_Async_Job_T xdata *job = &eeprom_async_queue[eeprom_async_head];
+    uint8_t page_length = EEPROM_Async_PageLength(job);
+
+    eeprom_async_pending = 0;
+
+    job->addr += page_length;
+    job->buf += page_length;
+    job->length -= page_length;
+
+    if (job->length == 0)
+    {
+        EEPROM_Async_Finish(EEPROM_OK);
+    }
+
+    EEPROM_Async_Start();
+}
+
+/**
+ * @brief 结束队首请求：移出队列并调用回调函数
+ * @note 调用方在本函数返回后调用 EEPROM_Async_Start()，发出回调中提交的请求
+ * @param result 请求结果
+ * @return None
+ */
+static void EEPROM_Async_Finish(EEPROM_Error_T result)
+{
+    EEPROM_Async_Callback_T callback = eeprom_async_queue[eeprom_async_head].callback;
+
+    eeprom_async_head = (eeprom_async_head + 1) % EEPROM_ASYNC_QUEUE_LEN;
+    eeprom_async_count --;
+
+    if (eeprom_async_count == 0)
+    {
+        soft_timer_stop(SOFT_TIMER_ID_EEPROM_ASYNC);
+    }
+
+    if (callback != NULL)
+    {
+        eeprom_async_in_callback = 1;
+        callback(result);
+        eeprom_async_in_callback = 0;
+    }
+}
@@ -0,0 +1,89 @@
+/**
+ * @file    eeprom_async_hal.h
+ * @brief   EEPROM 异步（非阻塞）写入 HAL 接口
+ * @author  ForeverMySunyu
+ * @version 1.0.3
+ * @date    2026-10-18
+ *
+ * @details
+ *  - EEPROM_Async_Write() 把写入请求放入队列后立即返回，第一页随即发出
+ *  - 内部写周期（约 5ms）期间 CPU 不再阻塞：EEPROM_Async_Task() 每个软件定时器节拍最多做 1 次 ACK 探测
+ *    （START + 设备地址 + STOP），写周期中总线大部分时间空闲；器件应答后自动发出下一页
+ *  - 每个请求完成（或失败）时调用该请求的回调函数，也可用 EEPROM_Async_Busy() 查询；
+ *    回调中可以再次调用 EEPROM_Async_Write()（如失败后重试），该请求在回调返回后发出
+ *
+ * @attention 请求只保存缓冲区指针，回调之前不能修改或释放缓冲区
+ * @attention 队列非空时 EEPROM 处于写周期中，对其他接口（EEPROM_ByteRead() 等）无应答；
+ *            需要同步访问时先调用 EEPROM_Async_Flush()
+ * @attention 写周期超时依赖软件定时器（soft_timer_init() 且 Timer2 已启动）
+ *
+ * @code{.c}
+ * EEPROM_Async_Write(0x0100, settings, sizeof(settings), on_saved);
+ * while (1)
+ * {
+ *     EEPROM_Async_Task();
+ *     // ... 刷新显示、扫描按键 ...
+ * }
+ * @endcode
+ */
+
+#ifndef _EEPROM_ASYNC_HAL_H_
+#define _EEPROM_ASYNC_HAL_H_
+
+#include "stdint.h"
+#include "stdbool.h"
+#include "eeprom_hal.h"
+
+/* ========================= 类型定义区域 ========================= */
+
+//! 写入完成回调函数，result 为该请求的最终结果
+typedef void (*EEPROM_Async_Callback_T)(EEPROM_Error_T result);
+
+/* ========================= API 函数声明区域 ========================= */
+
+/**
+ * @brief 异步写入初始化（清空队列）
+ * @param None
+ * @return None
+ */
+void EEPROM_Async_Init(void);
+
+/**
+ * @brief 提交异步写入请求
+ * @note 队列原本为空时第一页在本函数内发出
+ * @param addr EEPROM 内部数据地址（起始存储地址）
+ * @param buf 1 个指针，指向：存放要写入数据的变量（完成前保持不变）
+ * @param length 要写入的字节数
+ * @param callback 完成回调函数，可为 NULL
+ * @return EEPROM 驱动程序错误码
+ * @retval EEPROM_OK - 已加入队列
+ *         EEPROM_ERR_DATA_SIZE - 地址范围错误
+ *         EEPROM_ERR_SLAVE_BUSY - 队列已满
+ */
+EEPROM_Error_T EEPROM_Async_Write(uint16_t addr, uint8_t *buf, uint16_t length, EEPROM_Async_Callback_T callback);
+
+/**
+ * @brief 异步写入后台任务（在主循环中周期性调用）
+ * @note 每个软件定时器节拍（SOFT_TIMER_TICK_MS）最多 1 次 ACK 探测，同一节拍内的其他调用直接返回；写周期完成后发出下一页；
+ *       超时仍无应答时该请求以 EEPROM_ERR_TIMEOUT 结束，最后一次探测时总线故障（START 失败）则以 EEPROM_ERR_IIC 结束
+ * @param None
+ * @return None
+ */
+void EEPROM_Async_Task(void);
+
+/**
+ * @brief 查询是否有未完成的异步写入
+ * @param None
+ * @return 1-有，0-队列为空
+ */
+bool EEPROM_Async_Busy(void);
+
+/**
+ * @brief 阻塞等待全部异步写入完成
+ * @note 以 EEPROM_AckPolling() 等待每一页的写周期
+ * @param None
+ * @return None
+ */
+void EEPROM_Async_Flush(void);
+
+#endif      /* _EEPROM_ASYNC_HAL_H_ */
@@ -0,0 +1,369 @@
+/**
+ * @file    eeprom_cache_hal.c
+ * @brief   EEPROM 页缓存（写回缓存）HAL 源文件
+ * @author  ForeverMySunyu
+ * @version 1.0.1
+ * @date    2026-10-18
+ *
+ * @details
+ *  - 每个缓存页：页号、有效标志、使用时间戳（用于 LRU 换出）、页数据、脏字节位图
+ *  - 换出顺序：空闲页 → 最久未使用的干净页 → 最久未使用的脏页（先刷新）
+ */
+
+#include "../config/eeprom_configuration.h"
+#include "../config/timer_configuration.h"
+#include "../core/soft_timer.h"
+#include "eeprom_hal.h"
+#include "eeprom_cache_hal.h"
+
+/* ========================= 缓存数据结构 ========================= */
+
+#define EEPROM_CACHE_DIRTY_BYTES    (EEPROM_PAGE_SIZE / 8)      //! 脏字节位图长度（字节）
+#define EEPROM_CACHE_NO_PAGE        0xFFFF                      //! 空闲缓存页的页号
+
+typedef struct
+{
+    uint16_t page_num;                                  //! 缓存的页号（EEPROM_CACHE_NO_PAGE 表示空闲）
+    uint8_t stamp;                                      //! 最近一次使用的时间戳
+    bool dirty;                                         //! 是否有脏字节
+    uint8_t dirty_map[EEPROM_CACHE_DIRTY_BYTES];        //! 脏字节位图（bit = 1 表示该字节待写入）
+    uint8_t dat[EEPROM_PAGE_SIZE];                      //! 页数据
+} EEPROM_Cache_Page_T;
+
+static EEPROM_Cache_Page_T xdata eeprom_cache[EEPROM_CACHE_PAGES];     //! 缓存页
+static uint8_t eeprom_cache_clock = 0;                                  //! 时间戳计数器
+
+/* ========================= 内部函数声明区域 ========================= */
+
+static EEPROM_Error_T EEPROM_Cache_GetPage(uint16_t page_num, EEPROM_Cache_Page_T xdata **page);
+static EEPROM_Error_T EEPROM_Cache_FlushPage(EEPROM_Cache_Page_T xdata *page);
+
+/* ========================= API 函数定义区域 ========================= */
+
+/**
+ * @brief 页缓存初始化（清空全部缓存页）
+ * @param None
+ * @return None
+ */
+void EEPROM_Cache_Init(void)
+{
+    EEPROM_Cache_Invalidate();
+}
+
+/**
+ * @brief 经缓存读取
+ * @note 未命中的页整页读入缓存后再返回
+ * @param addr EEPROM 内部数据地址（起始读取地址）
+ * @param buf 1 个指针，指向：存放读取到的数据的变量
+ * @param length 要读取的字节数
+ * @return EEPROM 驱动程序错误码
+ */
+EEPROM_Error_T EEPROM_Cache_Read(uint16_t addr, uint8_t *buf, uint16_t length)
+{
+    EEPROM_Error_T eeprom_error;
+    EEPROM_Cache_Page_T xdata *page;
+    uint8_t row_num;
+
+    /* ===================== 参数检查 ===================== */
+
+    if ((length == 0) || ((uint32_t)addr + length > EEPROM_SIZE_BYTES))
+    {
+        return EEPROM_ERR_DATA_SIZE;
+    }
+
+    /* ===================== 逐页从缓存复制 ===================== */
+
+    while (length)
+    {
+        eeprom_error = EEPROM_Cache_GetPage(addr / EEPROM_PAGE_SIZE, &page);
+        if (eeprom_error != EEPROM_OK)
+        {
+            return eeprom_error;
+        }
+
+        for (row_num = addr % EEPROM_PAGE_SIZE; (row_num < EEPROM_PAGE_SIZE) && length; row_num++)
+        {
+            *buf = page->dat[row_num];
+
+            buf ++;
+            addr ++;
+            length --;
+        }
+    }
+
+    return EEPROM_OK;
+}
+
+/**
+ * @brief 经缓存写入
+ * @note 只修改缓存并记录脏字节（与缓存中内容相同的字节不标记为脏），实际写入在刷新时进行
+ * @param addr EEPROM 内部数据地址（起始存储地址）
+ * @param buf 1 个指针，指向：存放要写入数据的变量
+ * @param length 要写入的字节数
+ * @return EEPROM 驱动程序错误码
+ */
+EEPROM_Error_T EEPROM_Cache_Write(uint16_t addr, const uint8_t *buf, uint16_t length)
+{
+    EEPROM_Error_T eeprom_error;
+    EEPROM_Cache_Page_T xdata *page;
+    uint8_t row_num;
+
+    /* ===================== 参数检查 ===================== */
+
+    if ((length == 0) || ((uint32_t)addr + length > EEPROM_SIZE_BYTES))
+    {
+        return EEPROM_ERR_DATA_SIZE;
+    }
+
+    /* ===================== 逐页写入缓存 ===================== */
+
+    while (length)
+    {
+        eeprom_error = EEPROM_Cache_GetPage(addr / EEPROM_PAGE_SIZE, &page);
+        if (eeprom_error != EEPROM_OK)
+        {
+            return eeprom_error;
+        }
+
+        for (row_num = addr % EEPROM_PAGE_SIZE; (row_num < EEPROM_PAGE_SIZE) && length; row_num++)
+        {
+            if (page->dat[row_num] != *buf)
+            {
+                page->dat[row_num] = *buf;
+                page->dirty_map[row_num >> 3] |= (uint8_t)(0x01 << (row_num & 0x07));
+                page->dirty = 1;
+            }
+
+            buf ++;
+            addr ++;
+            length --;
+        }
+    }
+
+    /* 缓存变脏后启动自动刷新定时器（已在计时则不重新计时，保证最长延迟有界） */
+    #if EEPROM_CACHE_FLUSH_MS
+        if (EEPROM_Cache_Dirty() && !soft_timer_running(SOFT_TIMER_ID_EEPROM_CACHE))
+        {
+            soft_timer_start(SOFT_TIMER_ID_EEPROM_CACHE, EEPROM_CACHE_FLUSH_MS);
+        }
+    #endif
+
+    return EEPROM_OK;
+}
+
+/**
+ * @brief 把全部脏页写入 EEPROM
+ * @note 全部写入成功后才停止自动刷新定时器；写入失败时重新启动定时器，
+ *       未写入的脏页在 EEPROM_CACHE_FLUSH_MS 后由 EEPROM_Cache_Task() 重试
+ * @param None
+ * @return EEPROM 驱动程序错误码
+ */
+EEPROM_Error_T EEPROM_Cache_Flush(void)
+{
+    EEPROM_Error_T eeprom_error;
+    uint8_t i;
+
+    for (i = 0; i < EEPROM_CACHE_PAGES; i++)
+    {
+        eeprom_error = EEPROM_Cache_FlushPage(&eeprom_cache[i]);
+        if (eeprom_error != EEPROM_OK)
+        {
+            #if EEPROM_CACHE_FLUSH_MS
+                soft_timer_start(SOFT_TIMER_ID_EEPROM_CACHE, EEPROM_CACHE_FLUSH_MS);
+            #endif
+
+            return eeprom_error;
+        }
+    }
+
+    #if EEPROM_CACHE_FLUSH_MS
+        soft_timer_stop(SOFT_TIMER_ID_EEPROM_CACHE);
+    #endif
+
+    return EEPROM_OK;
+}
+
+/**
+ * @brief 丢弃全部缓存页（不写回）
+ * @param None
+ * @return None
+ */
+void EEPROM_Cache_Invalidate(void)
+{
+    uint8_t i;
+
+    for (i = 0; i < EEPROM_CACHE_PAGES; i++)
+    {
+        eeprom_cache[i].page_num = EEPROM_CACHE_NO_PAGE;
+        eeprom_cache[i].dirty = 0;
+    }
+
+    #if EEPROM_CACHE_FLUSH_MS
+        soft_timer_stop(SOFT_TIMER_ID_EEPROM_CACHE);
+    #endif
+}
+
+/**
+ * @brief 查询缓存中是否有尚未写入的数据
+ * @param None
+ * @return 1-有脏页，0-无
+ */
+bool EEPROM_Cache_Dirty(void)
+{
+    uint8_t i;
+
+    for (i = 0; i < EEPROM_CACHE_PAGES; i++)
+    {
+        if (eeprom_cache[i].dirty)
+        {
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+/**
+ * @brief 页缓存后台任务（在主循环中周期性调用）
+ * @note 自动刷新定时器到期时刷新全部脏页
+ * @param None
+ * @return EEPROM 驱动程序错误码
+ */
+EEPROM_Error_T EEPROM_Cache_Task(void)
+{
+    #if EEPROM_CACHE_FLUSH_MS
+        if (soft_timer_expired(SOFT_TIMER_ID_EEPROM_CACHE))
+        {
+            return EEPROM_Cache_Flush();
+        }
+    #endif
+
+    return EEPROM_OK;
+}
+
+/* ========================= 内部函数定义区域 ========================= */
+
+/**
+ * @brief 获取缓存页（未命中时换出并读入）
+ * @param page_num EEPROM 页号
+ * @param page 用于返回缓存页指针
+ * @return EEPROM 驱动程序错误码
+ */
+static EEPROM_Error_T EEPROM_Cache_GetPage(uint16_t page_num, EEPROM_Cache_Page_T xdata **page)
+{
+    EEPROM_Error_T eeprom_error;
+    EEPROM_Cache_Page_T xdata *victim = 0;
+    uint8_t victim_age = 0;
+    uint8_t age;
+    uint8_t i;
+
+    eeprom_cache_clock ++;
+
+    /* ===================== 查找命中页 ===================== */
+
+    for (i = 0; i < EEPROM_CACHE_PAGES; i++)
+    {
+        if (eeprom_cache[i].page_num == page_num)
+        {
+            eeprom_cache[i].stamp = eeprom_cache_clock;
+            *page = &eeprom_cache[i];
+            return EEPROM_OK;
+        }
+    }
+
+    /* ===================== 选择换出页：空闲页 → 最久未使用的干净页 → 最久未使用的脏页 ===================== */
+
+    for (i = 0; i < EEPROM_CACHE_PAGES; i++)
+    {
+        if (eeprom_cache[i].page_num == EEPROM_CACHE_NO_PAGE)
+        {
+            victim = &eeprom_cache[i];
+            break;
+        }
+
+        age = eeprom_cache_clock - eeprom_cache[i].stamp;
+
+        if ((victim == 0) ||
+            (victim->dirty && !eeprom_cache[i].dirty) ||
+            ((victim->dirty == eeprom_cache[i].dirty) && (age > victim_age)))
+        {
+            victim = &eeprom_cache[i];
+            victim_age = age;
+        }
+    }
+
+    /* 换出脏页前先写回 */
+    eeprom_error = EEPROM_Cache_FlushPage(victim);
+    if (eeprom_error != EEPROM_OK)
+    {
+        return eeprom_error;
+    }
+
+    /* ===================== 整页读入 ===================== */
+
+    victim->page_num = EEPROM_CACHE_NO_PAGE;
+
+    eeprom_error = EEPROM_PageRead(page_num, 0, victim->dat, EEPROM_PAGE_SIZE);
+    if (eeprom_error != EEPROM_OK)
+    {
+        return eeprom_error;
+    }
+
+    victim->page_num = page_num;
+    victim->stamp = eeprom_cache_clock;
+    victim->dirty = 0;
+    for (i = 0; i < EEPROM_CACHE_DIRTY_BYTES; i++)
+    {
+        victim->dirty_map[i] = 0;
+    }
+
+    *page = victim;
+
+    return EEPROM_OK;
+}
+
+/**
+ * @brief 写回 1 个缓存页
+ * @note 从第一个脏字节到最后一个脏字节作为 1 次页写入（中间未修改的字节按缓存内容原样写入）
+ * @param page 缓存页指针
+ * @return EEPROM 驱动程序错误码
+ */
+static EEPROM_Error_T EEPROM_Cache_FlushPage(EEPROM_Cache_Page_T xdata *page)
+{
+    EEPROM_Error_T eeprom_error;
+    uint8_t first = EEPROM_PAGE_SIZE;
+    uint8_t last = 0;
+    uint8_t row_num;
+
+    if ((page->page_num == EEPROM_CACHE_NO_PAGE) || !page->dirty)
+    {
+        return EEPROM_OK;
+    }
+
+    /* 确定脏字节范围 */
+    for (row_num = 0; row_num < EEPROM_PAGE_SIZE; row_num++)
+    {
+        if (page->dirty_map[row_num >> 3] & (uint8_t)(0x01 << (row_num & 0x07)))
+        {
+            if (first == EEPROM_PAGE_SIZE)
+            {
+                first = row_num;
+            }
+            last = row_num;
+        }
+    }
+
+    eeprom_error = EEPROM_PageWrite(page->page_num, first, &page->dat[first], last - first + 1);
+    if (eeprom_error != EEPROM_OK)
+    {
+        return eeprom_error;
+    }
+
+    page->dirty = 0;
+    for (row_num = 0; row_num < EEPROM_CACHE_DIRTY_BYTES; row_num++)
+    {
+        page->dirty_map[row_num] = 0;
+    }
+
+    return EEPROM_OK;
+}
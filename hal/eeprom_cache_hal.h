@@ -0,0 +1,85 @@
+/**
+ * @file    eeprom_cache_hal.h
+ * @brief   EEPROM 页缓存（写回缓存）HAL 接口
+ * @author  ForeverMySunyu
+ * @version 1.0.0
+ * @date    2026-10-18
+ *
+ * @details
+ *  - 在 xdata 中缓存 EEPROM_CACHE_PAGES 个整页，读命中直接从 RAM 返回，不访问 IIC 总线
+ *  - 写入只修改 RAM 并按字节记录脏位，刷新时每个脏页从第一个脏字节到最后一个脏字节作为 1 次页写入，
+ *    同一页的多次零散写入只消耗 1 次内部写周期
+ *  - 刷新时机：调用 EEPROM_Cache_Flush()；或缓存变脏后 EEPROM_CACHE_FLUSH_MS 到期，由 EEPROM_Cache_Task() 刷新；
+ *    缓存已满且全部为脏页时，换出最久未使用的页前先刷新该页
+ *
+ * @attention 通过缓存访问的地址范围不要再直接调用 EEPROM_ByteWrite() 等接口写入，否则缓存内容会过期；
+ *            必须混用时，先调用 EEPROM_Cache_Flush() 再调用 EEPROM_Cache_Invalidate()
+ * @attention 自动刷新需要软件定时器（soft_timer_init() 且 Timer2 已启动），并在主循环中周期性调用 EEPROM_Cache_Task()
+ */
+
+#ifndef _EEPROM_CACHE_HAL_H_
+#define _EEPROM_CACHE_HAL_H_
+
+#include "stdint.h"
+#include "stdbool.h"
+#include "eeprom_hal.h"
+
+/* ========================= API 函数声明区域 ========================= */
+
+/**
+ * @brief 页缓存初始化（清空全部缓存页）
+ * @param None
+ * @return None
+ */
+void EEPROM_Cache_Init(void);
+
+/**
+ * @brief 经缓存读取
+ * @note 未命中的页整页读入缓存后再返回
+ * @param addr EEPROM 内部数据地址（起始读取地址）
+ * @param buf 1 个指针，指向：存放读取到的数据的变量
+ * @param length 要读取的字节数
+ * @return EEPROM 驱动程序错误码
+ */
+EEPROM_Error_T EEPROM_Cache_Read(uint16_t addr, uint8_t *buf, uint16_t length);
+
+/**
+ * @brief 经缓存写入
+ * @note 只修改缓存并记录脏字节，实际写入在刷新时进行
+ * @param addr EEPROM 内部数据地址（起始存储地址）
+ * @param buf 1 个指针，指向：存放要写入数据的变量
+ * @param length 要写入的字节数
+ * @return EEPROM 驱动程序错误码
+ */
+EEPROM_Error_T EEPROM_Cache_Write(uint16_t addr, const uint8_t *buf, uint16_t length);
+
+/**
+ * @brief 把全部脏页写入 EEPROM
+ * @param None
+ * @return EEPROM 驱动程序错误码
+ */
+EEPROM_Error_T EEPROM_Cache_Flush(void);
+
+/**
+ * @brief 丢弃全部缓存页（不写回）
+ * @param None
+ * @return None
+ */
+void EEPROM_Cache_Invalidate(void);
+
+/**
+ * @brief 查询缓存中是否有尚未写入的数据
+ * @param None
+ * @return 1-有脏页，0-无
+ */
+bool EEPROM_Cache_Dirty(void);
+
+/**
+ * @brief 页缓存后台任务（在主循环中周期性调用）
+ * @note 自动刷新定时器到期时刷新全部脏页
+ * @param None
+ * @return EEPROM 驱动程序错误码
+ */
+EEPROM_Error_T EEPROM_Cache_Task(void);
+
+#endif      /* _EEPROM_CACHE_HAL_H_ */
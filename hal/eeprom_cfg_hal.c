@@ -0,0 +1,262 @@
+/**
+ * @file    eeprom_cfg_hal.c
+ * @brief   EEPROM 掉电安全的配置数据保存（A/B 双槽）HAL 源文件
+ * @author  ForeverMySunyu
+ * @version 1.0.0
+ * @date    2026-10-18
+ *
+ * @details
+ *  - 槽头（8 字节，位于槽起始页内，1 次页写入完成）：
+ *    序号(2) + 数据长度(2) + 数据 CRC16(2) + 槽头 CRC16(2，前 6 字节)，多字节数据低字节在前
+ *  - 序号按 16 位回绕比较：(int16_t)(a - b) > 0 表示 a 较新
+ */
+
+#include <stddef.h>
+#include "../config/eeprom_configuration.h"
+#include "../core/crc.h"
+#include "eeprom_hal.h"
+#include "eeprom_cfg_hal.h"
+
+#if (EEPROM_CFG_BASE_ADDR % EEPROM_PAGE_SIZE) || (EEPROM_CFG_SLOT_SIZE % EEPROM_PAGE_SIZE)
+    #error "EEPROM_CFG_BASE_ADDR and EEPROM_CFG_SLOT_SIZE must be multiples of EEPROM_PAGE_SIZE"
+#endif
+
+#if (EEPROM_CFG_BASE_ADDR + 2 * EEPROM_CFG_SLOT_SIZE) > EEPROM_SIZE_BYTES
+    #error "EEPROM config slots exceed EEPROM_SIZE_BYTES"
+#endif
+
+#if (EEPROM_PAGE_SIZE < 8)
+    #error "EEPROM config slot header needs EEPROM_PAGE_SIZE >= 8"
+#endif
+
+/* ========================= 槽格式 ========================= */
+
+#define CFG_HDR_SIZE            8           //! 槽头字节数
+#define CFG_DATA_MAX            (EEPROM_CFG_SLOT_SIZE - CFG_HDR_SIZE)   //! 配置数据最大字节数
+#define CFG_NONE                0xFF        //! 没有有效槽
+
+//! 槽 slot（0-A，1-B）的起始地址
+#define CFG_SLOT_ADDR(slot)     ((uint16_t)(EEPROM_CFG_BASE_ADDR + (uint16_t)(slot) * EEPROM_CFG_SLOT_SIZE))
+
+/* ========================= 槽状态 ========================= */
+
+typedef struct
+{
+    bool valid;         //! 槽头是否有效
+    uint16_t seq;       //! 序号
+    uint16_t length;    //! 数据长度
+    uint16_t crc;       //! 数据 CRC16
+} CFG_Slot_T;
+
+static CFG_Slot_T cfg_slot[2];          //! A、B 槽的槽头
+static uint8_t cfg_current = CFG_NONE;  //! 最新的有效槽
+
+/* ========================= 内部函数声明区域 ========================= */
+
+static EEPROM_Error_T CFG_ReadHeader(uint8_t slot);
+static void CFG_SelectNewest(void);
+
+/* ========================= API 函数定义区域 ========================= */
+
+/**
+ * @brief 读取两个槽头，选出最新的有效槽
+ * @param None
+ * @return EEPROM 驱动程序错误码（没有有效槽时也返回 EEPROM_OK，之后 EEPROM_Cfg_Load() 返回 EEPROM_ERR_NOT_FOUND）
+ */
+EEPROM_Error_T EEPROM_Cfg_Mount(void)
+{
+    EEPROM_Error_T eeprom_error;
+    uint8_t slot;
+
+    for (slot = 0; slot < 2; slot++)
+    {
+        eeprom_error = CFG_ReadHeader(slot);
+        if (eeprom_error != EEPROM_OK)
+        {
+            return eeprom_error;
+        }
+    }
+
+    CFG_SelectNewest();
+
+    return EEPROM_OK;
+}
+
+/**
+ * @brief 读取最新的配置数据
+ * @note 数据 CRC 校验失败时该槽作废，改读另一个槽
+ * @param buf 1 个指针，指向：存放配置数据的缓冲区
+ * @param size 缓冲区大小（字节），数据更长时返回 EEPROM_ERR_DATA_SIZE
+ * @param length 用于返回配置数据的字节数，可为 NULL
+ * @return EEPROM 驱动程序错误码
+ */
+EEPROM_Error_T EEPROM_Cfg_Load(uint8_t *buf, uint16_t size, uint16_t *length)
+{
+    EEPROM_Error_T eeprom_error;
+    CFG_Slot_T *slot;
+
+    while (cfg_current != CFG_NONE)
+    {
+        slot = &cfg_slot[cfg_current];
+
+        if (slot->length > size)
+        {
+            return EEPROM_ERR_DATA_SIZE;
+        }
+
+        eeprom_error = EEPROM_ReadMultiByte(CFG_SLOT_ADDR(cfg_current) + CFG_HDR_SIZE, buf, slot->length);
+        if (eeprom_error != EEPROM_OK)
+        {
+            return eeprom_error;
+        }
+
+        if (crc16_ccitt(CRC16_CCITT_INIT, buf, slot->length) == slot->crc)
+        {
+            if (length != NULL)
+            {
+                *length = slot->length;
+            }
+
+            return EEPROM_OK;
+        }
+
+        /* 数据损坏：作废该槽，改用另一个槽 */
+        slot->valid = 0;
+        CFG_SelectNewest();
+    }
+
+    return EEPROM_ERR_NOT_FOUND;
+}
+
+/**
+ * @brief 保存配置数据（写入较旧的槽）
+ * @note 先写数据、后写槽头，槽头写入完成之前上电读取到的仍是原来的槽
+ * @param buf 1 个指针，指向：要保存的配置数据
+ * @param length 配置数据字节数（1 ~ EEPROM_CFG_SLOT_SIZE-8）
+ * @return EEPROM 驱动程序错误码
+ */
+EEPROM_Error_T EEPROM_Cfg_Save(uint8_t *buf, uint16_t length)
+{
+    EEPROM_Error_T eeprom_error;
+    uint8_t header[CFG_HDR_SIZE];
+    uint8_t target;
+    uint16_t seq;
+    uint16_t crc;
+
+    if ((length == 0) || (length > CFG_DATA_MAX))
+    {
+        return EEPROM_ERR_DATA_SIZE;
+    }
+
+    /* 写入较旧（或无效）的槽，序号为最新序号 +1 */
+    if (cfg_current == CFG_NONE)
+    {
+        target = 0;
+        seq = 0;
+    }
+    else
+    {
+        target = cfg_current ^ 0x01;
+        seq = cfg_slot[cfg_current].seq + 1;
+    }
+
+    /* ===================== 写数据 ===================== */
+
+    eeprom_error = EEPROM_WriteMultiByte(CFG_SLOT_ADDR(target) + CFG_HDR_SIZE, buf, length);
+    if (eeprom_error != EEPROM_OK)
+    {
+        return eeprom_error;
+    }
+
+    /* ===================== 写槽头（1 次页写入） ===================== */
+
+    crc = crc16_ccitt(CRC16_CCITT_INIT, buf, length);
+
+    header[0] = (uint8_t)seq;
+    header[1] = (uint8_t)(seq >> 8);
+    header[2] = (uint8_t)length;
+    header[3] = (uint8_t)(length >> 8);
+    header[4] = (uint8_t)crc;
+    header[5] = (uint8_t)(crc >> 8);
+    crc = crc16_ccitt(CRC16_CCITT_INIT, header, 6);
+    header[6] = (uint8_t)crc;
+    header[7] = (uint8_t)(crc >> 8);
+
+    eeprom_error = EEPROM_PageWrite(CFG_SLOT_ADDR(target) / EEPROM_PAGE_SIZE, 0, header, CFG_HDR_SIZE);
+    if (eeprom_error != EEPROM_OK)
+    {
+        return eeprom_error;
+    }
+
+    cfg_slot[target].valid = 1;
+    cfg_slot[target].seq = seq;
+    cfg_slot[target].length = length;
+    cfg_slot[target].crc = header[4] | ((uint16_t)header[5] << 8);
+    cfg_current = target;
+
+    return EEPROM_OK;
+}
+
+/**
+ * @brief 获取最新配置数据的字节数
+ * @param None
+ * @return 字节数，没有有效槽时返回 0
+ */
+uint16_t EEPROM_Cfg_Length(void)
+{
+    return (cfg_current == CFG_NONE) ? 0 : cfg_slot[cfg_current].length;
+}
+
+/* ========================= 内部函数定义区域 ========================= */
+
+/**
+ * @brief 读取并校验槽头
+ * @param slot 槽号（0-A，1-B）
+ * @return EEPROM 驱动程序错误码（槽头无效不算错误，只把该槽标记为无效）
+ */
+static EEPROM_Error_T CFG_ReadHeader(uint8_t slot)
+{
+    EEPROM_Error_T eeprom_error;
+    uint8_t header[CFG_HDR_SIZE];
+    CFG_Slot_T *s = &cfg_slot[slot];
+
+    eeprom_error = EEPROM_ReadMultiByte(CFG_SLOT_ADDR(slot), header, CFG_HDR_SIZE);
+    if (eeprom_error != EEPROM_OK)
+    {
+        return eeprom_error;
+    }
+
+    s->seq = header[0] | ((uint16_t)header[1] << 8);
+    s->length = header[2] | ((uint16_t)header[3] << 8);
+    s->crc = header[4] | ((uint16_t)header[5] << 8);
+
+    s->valid = (crc16_ccitt(CRC16_CCITT_INIT, header, 6) == (header[6] | ((uint16_t)header[7] << 8))) &&
+               (s->length != 0) && (s->length <= CFG_DATA_MAX);
+
+    return EEPROM_OK;
+}
+
+/**
+ * @brief 在有效槽中选出序号最新的槽
+ * @param None
+ * @return None
+ */
+static void CFG_SelectNewest(void)
+{
+    if (cfg_slot[0].valid && cfg_slot[1].valid)
+    {
+        cfg_current = ((int16_t)(cfg_slot[1].seq - cfg_slot[0].seq) > 0) ? 1 : 0;
+    }
+    else if (cfg_slot[0].valid)
+    {
+        cfg_current = 0;
+    }
+    else if (cfg_slot[1].valid)
+    {
+        cfg_current = 1;
+    }
+    else
+    {
+        cfg_current = CFG_NONE;
+    }
+}
@@ -0,0 +1,67 @@
+/**
+ * @file    eeprom_cfg_hal.h
+ * @brief   EEPROM 掉电安全的配置数据保存（A/B 双槽）HAL 接口
+ * @author  ForeverMySunyu
+ * @version 1.0.0
+ * @date    2026-10-18
+ *
+ * @details
+ *  - 每次保存写入较旧的那个槽：先写数据，最后用 1 次页写入写槽头（序号、长度、数据 CRC16、槽头 CRC16），
+ *    写数据或写槽头时掉电，另一个槽保持完整
+ *  - 上电时 EEPROM_Cfg_Mount() 只读取两个槽头（各 8 字节）就能选出最新的有效槽，与配置数据长度无关
+ *  - EEPROM_Cfg_Load() 读取数据时再校验数据 CRC，失败时退回另一个槽
+ *
+ * @code{.c}
+ * EEPROM_Cfg_Mount();
+ * if (EEPROM_Cfg_Load((uint8_t *)&config, sizeof(config), NULL) != EEPROM_OK)
+ * {
+ *     config_set_default(&config);
+ * }
+ * ...
+ * EEPROM_Cfg_Save((uint8_t *)&config, sizeof(config));
+ * @endcode
+ */
+
+#ifndef _EEPROM_CFG_HAL_H_
+#define _EEPROM_CFG_HAL_H_
+
+#include "stdint.h"
+#include "stdbool.h"
+#include "eeprom_hal.h"
+
+/* ========================= API 函数声明区域 ========================= */
+
+/**
+ * @brief 读取两个槽头，选出最新的有效槽
+ * @param None
+ * @return EEPROM 驱动程序错误码（没有有效槽时也返回 EEPROM_OK，之后 EEPROM_Cfg_Load() 返回 EEPROM_ERR_NOT_FOUND）
+ */
+EEPROM_Error_T EEPROM_Cfg_Mount(void);
+
+/**
+ * @brief 读取最新的配置数据
+ * @param buf 1 个指针，指向：存放配置数据的缓冲区
+ * @param size 缓冲区大小（字节），数据更长时返回 EEPROM_ERR_DATA_SIZE
+ * @param length 用于返回配置数据的字节数，可为 NULL
+ * @return EEPROM 驱动程序错误码
+ * @retval EEPROM_OK - 读取成功
+ *         EEPROM_ERR_NOT_FOUND - 两个槽都没有有效数据
+ */
+EEPROM_Error_T EEPROM_Cfg_Load(uint8_t *buf, uint16_t size, uint16_t *length);
+
+/**
+ * @brief 保存配置数据（写入较旧的槽）
+ * @param buf 1 个指针，指向：要保存的配置数据
+ * @param length 配置数据字节数（1 ~ EEPROM_CFG_SLOT_SIZE-8）
+ * @return EEPROM 驱动程序错误码
+ */
+EEPROM_Error_T EEPROM_Cfg_Save(uint8_t *buf, uint16_t length);
+
+/**
+ * @brief 获取最新配置数据的字节数
+ * @param None
+ * @return 字节数，没有有效槽时返回 0
+ */
+uint16_t EEPROM_Cfg_Length(void);
+
+#endif      /* _EEPROM_CFG_HAL_H_ */
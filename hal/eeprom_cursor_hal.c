@@ -0,0 +1,136 @@
+/**
+ * @file    eeprom_cursor_hal.c
+ * @brief   EEPROM 顺序读取游标（预读缓冲）HAL 源文件
+ * @author  ForeverMySunyu
+ * @version 1.0.0
+ * @date    2026-10-18
+ *
+ * @details
+ *  - 缓冲区保存从 cursor_base 开始的 cursor_fill 个字节，游标位置 = cursor_base + cursor_index
+ *  - EEPROM_Cursor_Getc() 命中时只比较 1 字节下标，补充时从游标位置顺序读取（到 EEPROM 末尾为止）
+ */
+
+#include "../config/eeprom_configuration.h"
+#include "eeprom_hal.h"
+#include "eeprom_cursor_hal.h"
+
+/* ========================= 游标状态 ========================= */
+
+static uint8_t xdata cursor_buf[EEPROM_CURSOR_BUF_SIZE];     //! 预读缓冲区
+static uint16_t cursor_base = 0;                            //! 缓冲区第一个字节的 EEPROM 地址
+static uint8_t cursor_fill = 0;                             //! 缓冲区中的有效字节数
+static uint8_t cursor_index = 0;                            //! 游标在缓冲区中的位置
+
+/* ========================= 内部函数声明区域 ========================= */
+
+static EEPROM_Error_T CURSOR_Refill(void);
+
+/* ========================= API 函数定义区域 ========================= */
+
+/**
+ * @brief 打开游标（清空预读缓冲区）
+ * @param addr EEPROM 内部数据地址（第一个要读取的字节）
+ * @return EEPROM 驱动程序错误码
+ */
+EEPROM_Error_T EEPROM_Cursor_Open(uint16_t addr)
+{
+    if (addr >= EEPROM_SIZE_BYTES)
+    {
+        return EEPROM_ERR_WORD_ADDR;
+    }
+
+    cursor_base = addr;
+    cursor_fill = 0;
+    cursor_index = 0;
+
+    return EEPROM_OK;
+}
+
+/**
+ * @brief 读取游标处的 1 字节，游标后移 1 字节
+ * @param c 1 个指针，指向：存放读取到的数据的变量
+ * @return EEPROM 驱动程序错误码
+ */
+EEPROM_Error_T EEPROM_Cursor_Getc(uint8_t *c)
+{
+    EEPROM_Error_T eeprom_error;
+
+    if (cursor_index >= cursor_fill)
+    {
+        eeprom_error = CURSOR_Refill();
+        if (eeprom_error != EEPROM_OK)
+        {
+            return eeprom_error;
+        }
+    }
+
+    *c = cursor_buf[cursor_index ++];
+
+    return EEPROM_OK;
+}
+
+/**
+ * @brief 移动游标
+ * @note 目标地址在预读缓冲区内时不访问总线，否则等同于 EEPROM_Cursor_Open()
+ * @param addr EEPROM 内部数据地址
+ * @return EEPROM 驱动程序错误码
+ */
+EEPROM_Error_T EEPROM_Cursor_Seek(uint16_t addr)
+{
+    if ((addr >= cursor_base) && (addr - cursor_base < cursor_fill))
+    {
+        cursor_index = addr - cursor_base;
+        return EEPROM_OK;
+    }
+
+    return EEPROM_Cursor_Open(addr);
+}
+
+/**
+ * @brief 获取游标位置
+ * @param None
+ * @return 下一个要读取的字节的 EEPROM 内部数据地址
+ */
+uint16_t EEPROM_Cursor_Tell(void)
+{
+    return cursor_base + cursor_index;
+}
+
+/* ========================= 内部函数定义区域 ========================= */
+
+/**
+ * @brief 从游标位置开始补充预读缓冲区（1 次顺序读）
+ * @param None
+ * @return EEPROM 驱动程序错误码（已到 EEPROM 末尾时返回 EEPROM_ERR_WORD_ADDR）
+ */
+static EEPROM_Error_T CURSOR_Refill(void)
+{
+    EEPROM_Error_T eeprom_error;
+    uint32_t next = (uint32_t)cursor_base + cursor_index;
+    uint8_t length = EEPROM_CURSOR_BUF_SIZE;
+
+    if (next >= EEPROM_SIZE_BYTES)
+    {
+        return EEPROM_ERR_WORD_ADDR;
+    }
+
+    if (EEPROM_SIZE_BYTES - next < length)
+    {
+        length = EEPROM_SIZE_BYTES - next;
+    }
+
+    /* 读取失败时缓冲区为空，游标位置不变，下次调用重新读取 */
+    cursor_base = (uint16_t)next;
+    cursor_index = 0;
+    cursor_fill = 0;
+
+    eeprom_error = EEPROM_ReadMultiByte(cursor_base, cursor_buf, length);
+    if (eeprom_error != EEPROM_OK)
+    {
+        return eeprom_error;
+    }
+
+    cursor_fill = length;
+
+    return EEPROM_OK;
+}
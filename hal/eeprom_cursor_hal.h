@@ -0,0 +1,66 @@
+/**
+ * @file    eeprom_cursor_hal.h
+ * @brief   EEPROM 顺序读取游标（预读缓冲）HAL 接口
+ * @author  ForeverMySunyu
+ * @version 1.0.0
+ * @date    2026-10-18
+ *
+ * @details
+ *  - 逐字节解析 EEPROM 内容时，EEPROM_ByteRead() 每字节都要发送 START + 地址 + RESTART + STOP，
+ *    约 40 bit 的总线开销只换来 8 bit 数据
+ *  - 游标在 xdata 中预读 EEPROM_CURSOR_BUF_SIZE 字节，EEPROM_Cursor_Getc() 命中缓冲区时只是内存读取，
+ *    缓冲区读完后用 1 次顺序读补充，逐字节解析接近整块读取的吞吐量
+ *  - EEPROM_Cursor_Seek() 的目标仍在缓冲区内时不访问总线（适合跳过字段）
+ *
+ * @attention 预读的内容不会随写入更新；游标打开期间写入了 EEPROM 时，调用 EEPROM_Cursor_Open() 重新打开
+ *
+ * @code{.c}
+ * EEPROM_Cursor_Open(TABLE_ADDR);
+ * while (EEPROM_Cursor_Getc(&c) == EEPROM_OK && c != 0)
+ * {
+ *     parse(c);
+ * }
+ * @endcode
+ */
+
+#ifndef _EEPROM_CURSOR_HAL_H_
+#define _EEPROM_CURSOR_HAL_H_
+
+#include "stdint.h"
+#include "stdbool.h"
+#include "eeprom_hal.h"
+
+/* ========================= API 函数声明区域 ========================= */
+
+/**
+ * @brief 打开游标（清空预读缓冲区）
+ * @param addr EEPROM 内部数据地址（第一个要读取的字节）
+ * @return EEPROM 驱动程序错误码
+ */
+EEPROM_Error_T EEPROM_Cursor_Open(uint16_t addr);
+
+/**
+ * @brief 读取游标处的 1 字节，游标后移 1 字节
+ * @param c 1 个指针，指向：存放读取到的数据的变量
+ * @return EEPROM 驱动程序错误码
+ * @retval EEPROM_OK - 读取成功
+ *         EEPROM_ERR_WORD_ADDR - 已到 EEPROM 末尾
+ */
+EEPROM_Error_T EEPROM_Cursor_Getc(uint8_t *c);
+
+/**
+ * @brief 移动游标
+ * @note 目标地址在预读缓冲区内时不访问总线，否则等同于 EEPROM_Cursor_Open()
+ * @param addr EEPROM 内部数据地址
+ * @return EEPROM 驱动程序错误码
+ */
+EEPROM_Error_T EEPROM_Cursor_Seek(uint16_t addr);
+
+/**
+ * @brief 获取游标位置
+ * @param None
+ * @return 下一个要读取的字节的 EEPROM 内部数据地址
+ */
+uint16_t EEPROM_Cursor_Tell(void);
+
+#endif      /* _EEPROM_CURSOR_HAL_H_ */
@@ -2,8 +2,16 @@
  * @file    eeprom_hal.c
  * @brief   EEPROM HAL 驱动源文件
  * @author  ForeverMySunyu
- * @version 1.0.0
- * @date    2026-1-1
+ * @version 1.5.3
+ * @date    2026-10-18
+ *
+ * @details
+ *  - 器件参数（容量、页大小、字地址字节数、块选择位）全部取自 eeprom_configuration.h
+ *  - 内部数据地址统一为 uint16_t，最大支持 64KB（AT24C512）
+ *  - “START + 设备地址 + 字地址” 由 EEPROM_SendAddress() 统一发送，
+ *    单字节字地址器件的地址高位自动放入设备地址的块选择位
+ *  - 比较写入（EEPROM_WRITE_COMPARE）：重复写入相同的配置块时不消耗写周期和擦写寿命
+ *  - EEPROM_BACKEND 为 EEPROM_BACKEND_AT24 时生效；片内 IAP Flash 模拟后端见 eeprom_iap_hal.c
  */
 
 #include "../config/eeprom_configuration.h"
@@ -11,6 +19,43 @@
 #include "iic_hal.h"
 #include "eeprom_hal.h"
 
+#if (EEPROM_BACKEND == EEPROM_BACKEND_AT24)
+
+/* ========================= IIC 总线选择 ========================= */
+
+#define EEPROM_IIC(name)    IIC_BUS_API(EEPROM_IIC_BUS, name)       //! EEPROM 所在总线的 IIC API
+
+/* ========================= 设备地址计算 ========================= */
+
+//! 访问内部数据地址 addr 时使用的设备地址（写），单字节字地址器件的地址高位放入块选择位
+#if EEPROM_BLOCK_BITS
+    #define EEPROM_DEV_ADDR(addr)   ((uint8_t)(EEPROM_IIC_ADDR | (((addr) >> 7) & EEPROM_BLOCK_MASK)))
+#else
+    #define EEPROM_DEV_ADDR(addr)   ((uint8_t)EEPROM_IIC_ADDR)
+#endif
+
+//! 当前地址读取使用的设备地址：有块选择位时为最近一次寻址所在的块，否则为固定地址
+#if EEPROM_BLOCK_BITS
+    static uint8_t eeprom_last_dev_addr = EEPROM_IIC_ADDR;     //! 最近一次寻址的设备地址（含块选择位）
+    #define EEPROM_CUR_DEV_ADDR()   eeprom_last_dev_addr
+#else
+    #define EEPROM_CUR_DEV_ADDR()   ((uint8_t)EEPROM_IIC_ADDR)
+#endif
+
+/* ========================= 写入统计与比较写入 ========================= */
+
+static EEPROM_Stats_T eeprom_stats = {0};     //! 写入统计信息
+
+#if EEPROM_WRITE_COMPARE
+    static bool eeprom_compare_write = EEPROM_WRITE_COMPARE_DEFAULT;   //! 是否启用比较写入
+    static uint8_t xdata eeprom_compare_buf[EEPROM_PAGE_SIZE];         //! 比较缓冲区（1 页）
+#endif
+
+/* ========================= 内部函数声明区域 ========================= */
+
+static EEPROM_Error_T EEPROM_SendAddress(uint16_t addr);
+static EEPROM_Error_T EEPROM_ReadOpen(uint16_t addr);
+
 /* ========================= API 函数定义区域 ========================= */
 
 /**
@@ -18,9 +63,27 @@
  * @details 初始化 EEPROM 设备，检查设备是否就绪
  * @return EEPROM 驱动程序错误码
  */
-EEPROM_Error_T EEPROM_Init_hal()
+EEPROM_Error_T EEPROM_Init_hal(void)
 {
+    iic_states_t iic_state;     //! 用于存储 IIC 状态码
+
+    /* 初始化 EEPROM 所在的 IIC 总线 */
+    if (EEPROM_IIC(Init_hal)() != IIC_OK)
+    {
+        return EEPROM_ERR_IIC;
+    }
+
+    /* 发送设备地址，检查设备是否应答 */
+    if (EEPROM_IIC(Start)() != IIC_OK)
+    {
+        EEPROM_IIC(Stop)();
+        return EEPROM_ERR_IIC;
+    }
+
+    iic_state = EEPROM_IIC(SendByte)(EEPROM_IIC_ADDR);
+    EEPROM_IIC(Stop)();
 
+    return (iic_state == IIC_OK) ? EEPROM_OK : EEPROM_ERR_SLAVE_NACK;
 }
 
 /**
@@ -29,138 +92,132 @@ EEPROM_Error_T EEPROM_Init_hal()
  * @param write_byte 要写入的 1 字节数据
  * @return EEPROM 驱动程序错误码
  */
-EEPROM_Error_T EEPROM_ByteWrite(uint8_t addr, uint8_t write_byte)
+EEPROM_Error_T EEPROM_ByteWrite(uint16_t addr, uint8_t write_byte)
 {
-    iic_states_t iic_state;     //! 用于存储 IIC 状态码
+    EEPROM_Error_T eeprom_error;    //! 用于存储 EEPROM 错误码
+    iic_states_t iic_state;         //! 用于存储 IIC 状态码
 
     /* 内部数据地址参数检查 */
-    if (addr >= EEPROM_TOTAL_SIZE_KB)
+    if (addr >= EEPROM_SIZE_BYTES)
     {
         return EEPROM_ERR_WORD_ADDR;
     }
-    
-    /* 发送 START */
-    iic_state = IIC_Start();
-    if(iic_state != IIC_OK)
-    {
-        IIC_Stop();
-        return EEPROM_ERR_IIC;
-    }
 
-    /* 发送设备地址 + 写 */
-    iic_state = IIC_SendByte(EEPROM_IIC_ADDR);
-    if(iic_state == IIC_ERR_NACK)
+    /* 发送 START + 设备地址 + 内部数据地址 */
+    eeprom_error = EEPROM_SendAddress(addr);
+    if (eeprom_error != EEPROM_OK)
     {
-        IIC_Stop();
-        return EEPROM_ERR_SLAVE_NACK;
-    }
-
-    /* 发送 EEPROM 内部字节地址 */
-    iic_state = IIC_SendByte(addr);
-    if(iic_state == IIC_ERR_NACK)
-    {
-        IIC_Stop();
-        return EEPROM_ERR_SLAVE_NACK;
+        return eeprom_error;
     }
 
     /* 发送要写入的 8 bit 数据 */
-    iic_state = IIC_SendByte(write_byte);
+    iic_state = EEPROM_IIC(SendByte)(write_byte);
     if(iic_state == IIC_ERR_NACK)
     {
-        IIC_Stop();
+        EEPROM_IIC(Stop)();
         return EEPROM_ERR_SLAVE_NACK;
     }
 
     /* 发送 STOP */
-    iic_state = IIC_Stop();
+    iic_state = EEPROM_IIC(Stop)();
     if (iic_state != IIC_OK)
     {
-        IIC_Stop();
+        EEPROM_IIC(Stop)();
         return EEPROM_ERR_IIC;
     }
-    
+
     /* 通过延时函数，等待 EEPROM 内部写周期完成（可升级） */
     // delay_1ms(EEPROM_WRITE_TIME_MS);
 
     /* 通过轮询，等待 EEPROM 内部写周期完成 */
-    if (EEPROM_AckPolling() == EEPROM_OK)
+    if (EEPROM_AckPolling() != EEPROM_OK)
     {
-        return EEPROM_OK;
+        return EEPROM_ERR_WRITE;
+    }
+
+    return EEPROM_OK;
+}
+
+/**
+ * @brief 页写入函数
+ * @note 单页写入，不能跨页；返回前通过 ACK 轮询等待内部写周期完成
+ * @param page_num 页数，保存数据的页地址（从 0 开始计数）
+ * @param row_num 行数，在该页的第几行中开始保存数据（从 0 开始计数）
+ * @param buf 1 个指针，指向：存放要写入数据的变量
+ * @param length 要写入的字节数
+ * @return EEPROM 驱动程序错误码
+ */
+EEPROM_Error_T EEPROM_PageWrite(uint16_t page_num, uint8_t row_num, uint8_t *buf, uint8_t length)
+{
+    EEPROM_Error_T eeprom_error;    //! 用于存储 EEPROM 错误码
+
+    eeprom_error = EEPROM_PageSend(page_num, row_num, buf, length);
+    if (eeprom_error != EEPROM_OK)
+    {
+        return eeprom_error;
     }
-    else if (EEPROM_AckPolling() == EEPROM_ERR_SLAVE_BUSY)
+
+    /* ==================== 通过轮询，等待 EEPROM 内部写周期完成 ==================== */
+    if (EEPROM_AckPolling() != EEPROM_OK)
     {
         return EEPROM_ERR_WRITE;
     }
+
+    return EEPROM_OK;
 }
 
 /**
- * @brief 页写入函数
- * @note 单页写入，不能跨页
+ * @brief 页发送函数（不等待写周期）
+ * @note 单页写入，不能跨页；发送 STOP 后立即返回，此时 EEPROM 正在进行内部写周期，
+ *       完成前器件对任何访问都不应答，可用 EEPROM_AckProbe() 查询
  * @param page_num 页数，保存数据的页地址（从 0 开始计数）
  * @param row_num 行数，在该页的第几行中开始保存数据（从 0 开始计数）
  * @param buf 1 个指针，指向：存放要写入数据的变量
  * @param length 要写入的字节数
  * @return EEPROM 驱动程序错误码
  */
-EEPROM_Error_T EEPROM_PageWrite(uint8_t page_num, uint8_t row_num, uint8_t *buf, uint8_t length)
+EEPROM_Error_T EEPROM_PageSend(uint16_t page_num, uint8_t row_num, uint8_t *buf, uint8_t length)
 {
-    iic_states_t iic_state;     //! 用于存储 IIC 状态码
+    EEPROM_Error_T eeprom_error;    //! 用于存储 EEPROM 错误码
+    iic_states_t iic_state;         //! 用于存储 IIC 状态码
 
     /* ==================== 参数检查 ==================== */
 
     /* 页数检查 */
-    if (page_num >= EEPROM_MAX_PAGE_NUM)
+    if (page_num >= EEPROM_PAGE_NUM)
     {
         return EEPROM_ERR_PAGE_NUM;
     }
-    
+
     /* 行数检查 */
-    if (row_num >= EEPROM_PAGE_SIZE_KB)
+    if (row_num >= EEPROM_PAGE_SIZE)
     {
         return EEPROM_ERR_ROW_NUM;
     }
-    
+
     /* 数据长度（字节数）检查 */
-    /* 数据长度不能 >= 该页剩余字节数（该页剩余字节数 = 该页总字节数 - 起始行） */
-    if (length >= EEPROM_PAGE_SIZE_KB-row_num)
+    /* 数据长度不能为 0，也不能 > 该页剩余字节数（该页剩余字节数 = 该页总字节数 - 起始行） */
+    if ((length == 0) || (length > EEPROM_PAGE_SIZE-row_num))
     {
         return EEPROM_ERR_DATA_SIZE;
     }
 
     /* ==================== 开始页写入 ==================== */
 
-    /* 发送 START */
-    iic_state = IIC_Start();
-    if(iic_state != IIC_OK)
-    {
-        IIC_Stop();
-        return EEPROM_ERR_IIC;
-    }
-
-    /* 发送设备地址 + 写 */
-    iic_state = IIC_SendByte(EEPROM_IIC_ADDR);
-    if(iic_state == IIC_ERR_NACK)
+    /* 发送 START + 设备地址 + 内部数据地址（addr = EEPROM_PAGE_SIZE * page_num + row_num） */
+    eeprom_error = EEPROM_SendAddress(page_num * EEPROM_PAGE_SIZE + row_num);
+    if (eeprom_error != EEPROM_OK)
     {
-        IIC_Stop();
-        return EEPROM_ERR_SLAVE_NACK;
-    }
-
-    /* 发送 EEPROM 内部字节地址 */
-    /* 内部字节地址 addr = 0x08 * page_num + row_num */
-    iic_state = IIC_SendByte(0x08 * page_num + row_num);
-    if(iic_state == IIC_ERR_NACK)
-    {
-        IIC_Stop();
-        return EEPROM_ERR_SLAVE_NACK;
+        return eeprom_error;
     }
 
     /* 连续写入 length 个 8 bit 数据 */
     while (length)
     {
-        iic_state = IIC_SendByte(*buf);
+        iic_state = EEPROM_IIC(SendByte)(*buf);
         if(iic_state == IIC_ERR_NACK)
         {
-            IIC_Stop();
+            EEPROM_IIC(Stop)();
             return EEPROM_ERR_SLAVE_NACK;
         }
 
@@ -168,55 +225,52 @@ EEPROM_Error_T EEPROM_PageWrite(uint8_t page_num, uint8_t row_num, uint8_t *buf,
         buf ++;
         length --;
     }
-    
-    /* 发送 STOP */
-    iic_state = IIC_Stop();
+
+    /* 发送 STOP，EEPROM 开始内部写周期 */
+    iic_state = EEPROM_IIC(Stop)();
     if (iic_state != IIC_OK)
     {
-        IIC_Stop();
+        EEPROM_IIC(Stop)();
         return EEPROM_ERR_IIC;
     }
 
-    /* ==================== 通过轮询，等待 EEPROM 内部写周期完成 ==================== */
-    if (EEPROM_AckPolling() == EEPROM_OK)
-    {
-        return EEPROM_OK;
-    }
-    else if (EEPROM_AckPolling() == EEPROM_ERR_SLAVE_BUSY)
-    {
-        return EEPROM_ERR_WRITE;
-    }
+    return EEPROM_OK;
 }
 
 /**
  * @brief  多字节连续写入
- * @note 自动分页
+ * @note 自动分页，每页只消耗 1 次内部写周期
+ * @note 启用比较写入时，每页先读出比较，内容相同的页不写，不同的页只写最小的不同字节区间
  * @param addr EEPROM 内部数据地址（起始存储地址）
  * @param buf 1 个指针，指向：存放要写入数据的变量
  * @param length 要写入的字节数
  * @return EEPROM 驱动程序错误码
  */
-EEPROM_Error_T EEPROM_WriteMultiByte(uint8_t addr, uint8_t *buf, uint8_t length)
+EEPROM_Error_T EEPROM_WriteMultiByte(uint16_t addr, uint8_t *buf, uint16_t length)
 {
     EEPROM_Error_T eeprom_error;     //! 用于存储 EEPROM 错误码
-    uint8_t page_num, row_num, write_length;
+    uint16_t page_num;
+    uint8_t row_num, write_length;
+    #if EEPROM_WRITE_COMPARE
+        uint8_t first, last;
+    #endif
 
     /* ===================== 参数检查 ===================== */
 
     /* 内部数据起始地址检查 */
-    if (addr > EEPROM_TOTAL_SIZE_KB)
+    if (addr >= EEPROM_SIZE_BYTES)
     {
         return EEPROM_ERR_WORD_ADDR;
     }
 
     /* 写入字节数检查 */
-    if ((length == 0) || (length > EEPROM_TOTAL_SIZE_KB))
+    if ((length == 0) || (length > EEPROM_SIZE_BYTES))
     {
         return EEPROM_ERR_DATA_SIZE;
     }
-    
+
     /* 待写入的内部数据地址范围检查 */
-    if (addr + length > EEPROM_TOTAL_SIZE_KB)
+    if ((uint32_t)addr + length > EEPROM_SIZE_BYTES)
     {
         return EEPROM_ERR_DATA_SIZE;
     }
@@ -226,36 +280,76 @@ EEPROM_Error_T EEPROM_WriteMultiByte(uint8_t addr, uint8_t *buf, uint8_t length)
     while (length)
     {
         /* 计算当前页序数 */
-        page_num = addr / EEPROM_PAGE_SIZE_KB;
+        page_num = addr / EEPROM_PAGE_SIZE;
 
         /* 计算当前行数 */
-        row_num = addr % EEPROM_PAGE_SIZE_KB;
+        row_num = addr % EEPROM_PAGE_SIZE;
 
         /* 计算本页可写字节数 */
-        write_length = EEPROM_PAGE_SIZE_KB - row_num;
+        write_length = EEPROM_PAGE_SIZE - row_num;
 
         /* 如果本页可写字节数 > 需要写入的总字节数 */
         if (write_length > length)
         {
             write_length = length;
         }
-        
-        /* 页写入 */
-        eeprom_error = EEPROM_PageWrite(page_num, row_num, buf, write_length);
+
+        #if EEPROM_WRITE_COMPARE
+            if (eeprom_compare_write)
+            {
+                /* 读出本页目标区间，确定第一个和最后一个不同字节 */
+                eeprom_error = EEPROM_ReadMultiByte(addr, eeprom_compare_buf, write_length);
+                if (eeprom_error != EEPROM_OK)
+                {
+                    return EEPROM_ERR_READ;
+                }
+
+                for (first = 0; (first < write_length) && (eeprom_compare_buf[first] == buf[first]); first++);
+
+                /* 内容完全相同：跳过本页 */
+                if (first == write_length)
+                {
+                    EEPROM_STAT_ADD(eeprom_stats.page_skip, 1);
+                    EEPROM_STAT_ADD(eeprom_stats.byte_skip, write_length);
+
+                    addr += write_length;
+                    buf += write_length;
+                    length -= write_length;
+                    continue;
+                }
+
+                for (last = write_length - 1; eeprom_compare_buf[last] == buf[last]; last--);
+
+                /* 只写 [first, last] 区间 */
+                EEPROM_STAT_ADD(eeprom_stats.byte_skip, write_length - (last - first + 1));
+
+                eeprom_error = EEPROM_PageWrite(page_num, row_num + first, buf + first, last - first + 1);
+            }
+            else
+        #endif
+            {
+                eeprom_error = EEPROM_PageWrite(page_num, row_num, buf, write_length);
+            }
+
         if (eeprom_error != EEPROM_OK)
         {
             return EEPROM_ERR_WRITE;
         }
-        
+
+        EEPROM_STAT_ADD(eeprom_stats.page_write, 1);
+
         /* 更新地址、指针和待写入字节数 */
         addr += write_length;
         buf += write_length;
         length -= write_length;
     }
+
+    return EEPROM_OK;
 }
 
 /**
  * @brief 从当前地址读取1字节
+ * @note 有块选择位的器件（AT24C04/08/16）使用最近一次寻址所在的块
  * @param buf 1 个指针，指向：存放读取到的数据的变量
  * @return EEPROM 驱动程序错误码
  */
@@ -264,34 +358,34 @@ EEPROM_Error_T EEPROM_ReadCurrentByte(uint8_t *read_byte)
     iic_states_t iic_state;     //! 用于存储 IIC 状态码
 
     /* START */
-    iic_state = IIC_Start();
+    iic_state = EEPROM_IIC(Start)();
     if(iic_state != IIC_OK)
     {
-        IIC_Stop();
+        EEPROM_IIC(Stop)();
         return EEPROM_ERR_IIC;
     }
 
     /* EEPROM 设备地址 + 读 */
-    iic_state = IIC_SendByte(EEPROM_IIC_ADDR | 0x01);
+    iic_state = EEPROM_IIC(SendByte)(EEPROM_CUR_DEV_ADDR() | 0x01);
     if(iic_state == IIC_ERR_NACK)
     {
-        IIC_Stop();
+        EEPROM_IIC(Stop)();
         return EEPROM_ERR_SLAVE_NACK;
     }
 
     /* 读取 1 字节数据，并发送 NACK */
-    iic_state = IIC_ReceiveByte(read_byte, 0);
+    iic_state = EEPROM_IIC(ReceiveByte)(read_byte, 0);
     if (iic_state != IIC_OK)
     {
-        IIC_Stop();
+        EEPROM_IIC(Stop)();
         return EEPROM_ERR_IIC;
     }
 
     /* STOP */
-    iic_state = IIC_Stop();
+    iic_state = EEPROM_IIC(Stop)();
     if (iic_state != IIC_OK)
     {
-        IIC_Stop();
+        EEPROM_IIC(Stop)();
         return EEPROM_ERR_IIC;
     }
 
@@ -304,49 +398,19 @@ EEPROM_Error_T EEPROM_ReadCurrentByte(uint8_t *read_byte)
  * @param read_byte 1 个指针，指向用于存储读取到的 1 字节数据的变量
  * @return EEPROM 驱动程序错误码
  */
-EEPROM_Error_T EEPROM_ByteRead(uint8_t addr, uint8_t *read_byte)
+EEPROM_Error_T EEPROM_ByteRead(uint16_t addr, uint8_t *read_byte)
 {
-    iic_states_t iic_state;          //! 用于存储 IIC 状态码
-    EEPROM_Error_T eeprom_error;     //! 用于存储 EEPROM 错误码
-
     /* ==================== 参数检查 ==================== */
 
     /* 内部数据地址检查 */
-    if (addr >= EEPROM_TOTAL_SIZE_KB)
+    if (addr >= EEPROM_SIZE_BYTES)
     {
         return EEPROM_ERR_WORD_ADDR;
     }
 
     /* ==================== 开始读取 1 个字节 ==================== */
 
-    /* START */
-    iic_state = IIC_Start();
-    if(iic_state != IIC_OK)
-    {
-        IIC_Stop();
-        return EEPROM_ERR_IIC;
-    }
-
-    /* 发送 EEPROM 设备地址 + 写 */
-    iic_state = IIC_SendByte(EEPROM_IIC_ADDR);
-    if(iic_state == IIC_ERR_NACK)
-    {
-        IIC_Stop();
-        return EEPROM_ERR_SLAVE_NACK;
-    }
-
-    /* 发送 EEPROM 内部数据地址 */
-    iic_state = IIC_SendByte(addr);
-    if(iic_state == IIC_ERR_NACK)
-    {
-        IIC_Stop();
-        return EEPROM_ERR_SLAVE_NACK;
-    }
-
-    /* 调用 EEPROM_ReadCurrentByte(); 函数 */
-    eeprom_error = EEPROM_ReadCurrentByte(read_byte);
-
-    return eeprom_error;
+    return EEPROM_ReadMultiByte(addr, read_byte, 1);
 }
 
 /**
@@ -358,99 +422,102 @@ EEPROM_Error_T EEPROM_ByteRead(uint8_t addr, uint8_t *read_byte)
  * @param length 要读取的字节数
  * @return EEPROM 驱动程序错误码
  */
-EEPROM_Error_T EEPROM_PageRead(uint8_t page_num, uint8_t row_num, uint8_t *buf, uint8_t length)
+EEPROM_Error_T EEPROM_PageRead(uint16_t page_num, uint8_t row_num, uint8_t *buf, uint8_t length)
 {
-    iic_states_t iic_state;     //! 用于存储 IIC 状态码
-    uint8_t i;
-
     /* ==================== 参数检查 ==================== */
 
     /* 页数检查 */
-    if (page_num >= EEPROM_MAX_PAGE_NUM)
+    if (page_num >= EEPROM_PAGE_NUM)
     {
         return EEPROM_ERR_PAGE_NUM;
     }
-    
+
     /* 行数检查 */
-    if (row_num >= EEPROM_PAGE_SIZE_KB)
+    if (row_num >= EEPROM_PAGE_SIZE)
     {
         return EEPROM_ERR_ROW_NUM;
     }
-    
+
     /* 数据长度（字节数）检查 */
-    /* 数据长度不能 >= 该页剩余字节数（该页剩余字节数 = 该页总字节数 - 起始行） */
-    if (length >= EEPROM_PAGE_SIZE_KB-row_num)
+    /* 数据长度不能为 0，也不能 > 该页剩余字节数（该页剩余字节数 = 该页总字节数 - 起始行） */
+    if ((length == 0) || (length > EEPROM_PAGE_SIZE-row_num))
     {
         return EEPROM_ERR_DATA_SIZE;
     }
 
     /* ==================== 开始页读取 ==================== */
 
-    /* 发送 START */
-    iic_state = IIC_Start();
-    if(iic_state != IIC_OK)
-    {
-        IIC_Stop();
-        return EEPROM_ERR_IIC;
-    }
+    return EEPROM_ReadMultiByte(page_num * EEPROM_PAGE_SIZE + row_num, buf, length);
+}
 
-    /* 发送设备地址 + 写 */
-    iic_state = IIC_SendByte(EEPROM_IIC_ADDR);
-    if(iic_state == IIC_ERR_NACK)
+/**
+ * @brief 多字节连续读取
+ * @note 顺序读取，不受页边界限制，整个读取在 1 次 IIC 传输中完成
+ * @param addr EEPROM 内部数据地址（起始读取地址）
+ * @param buf 1 个指针，指向：存放读取到的数据的变量
+ * @param length 要读取的字节数
+ * @return EEPROM 驱动程序错误码
+ */
+EEPROM_Error_T EEPROM_ReadMultiByte(uint16_t addr, uint8_t *buf, uint16_t length)
+{
+    EEPROM_Error_T eeprom_error;    //! 用于存储 EEPROM 错误码
+    iic_states_t iic_state;         //! 用于存储 IIC 状态码
+
+    /* ===================== 参数检查 ===================== */
+
+    /* 内部数据起始地址检查 */
+    if (addr >= EEPROM_SIZE_BYTES)
     {
-        IIC_Stop();
-        return EEPROM_ERR_SLAVE_NACK;
+        return EEPROM_ERR_WORD_ADDR;
     }
 
-    /* 发送 EEPROM 内部字节地址 */
-    /* 内部字节地址 addr = 0x08 * page_num + row_num */
-    iic_state = IIC_SendByte(0x08 * page_num + row_num);
-    if(iic_state == IIC_ERR_NACK)
+    /* 读取字节数检查 */
+    if ((length == 0) || (length > EEPROM_SIZE_BYTES))
     {
-        IIC_Stop();
-        return EEPROM_ERR_SLAVE_NACK;
+        return EEPROM_ERR_DATA_SIZE;
     }
 
-    /* RESTART */
-    iic_state = IIC_Restart();
-    if(iic_state != IIC_OK)
+    /* 待读取的内部数据地址范围检查 */
+    if ((uint32_t)addr + length > EEPROM_SIZE_BYTES)
     {
-        IIC_Stop();
-        return EEPROM_ERR_IIC;
+        return EEPROM_ERR_DATA_SIZE;
     }
 
-    /* 发送 EEPROM 设备地址 + 读 */
-    iic_state = IIC_SendByte(EEPROM_IIC_ADDR | 0x01);
-    if(iic_state == IIC_ERR_NACK)
+    /* ===================== 开始连续读取 ===================== */
+
+    /* 发送 START + 设备地址 + 内部数据地址 + RESTART + 设备地址（读） */
+    eeprom_error = EEPROM_ReadOpen(addr);
+    if (eeprom_error != EEPROM_OK)
     {
-        IIC_Stop();
-        return EEPROM_ERR_SLAVE_NACK;
+        return eeprom_error;
     }
 
     /* 读取 (length-1) 个字节的数据，并在每次读取后发送 ACK */
-    for (i = 0; i < length-1; i++)
+    while (-- length)
     {
-        iic_state = IIC_ReceiveByte(buf + i, 1);
+        iic_state = EEPROM_IIC(ReceiveByte)(buf, 1);
         if (iic_state != IIC_OK)
         {
-            IIC_Stop();
+            EEPROM_IIC(Stop)();
             return EEPROM_ERR_IIC;
         }
+
+        buf ++;
     }
 
     /* 读取最后 1 个字节的数据，并发送 NACK */
-    iic_state = IIC_ReceiveByte(buf + length - 1, 0);
+    iic_state = EEPROM_IIC(ReceiveByte)(buf, 0);
     if (iic_state != IIC_OK)
     {
-        IIC_Stop();
+        EEPROM_IIC(Stop)();
         return EEPROM_ERR_IIC;
     }
 
     /* STOP */
-    iic_state = IIC_Stop();
+    iic_state = EEPROM_IIC(Stop)();
     if (iic_state != IIC_OK)
     {
-        IIC_Stop();
+        EEPROM_IIC(Stop)();
         return EEPROM_ERR_IIC;
     }
 
@@ -458,136 +525,135 @@ EEPROM_Error_T EEPROM_PageRead(uint8_t page_num, uint8_t row_num, uint8_t *buf,
 }
 
 /**
- * @brief 多字节连续读取
- * @note 自动分页
+ * @brief 流式连续读取
+ * @note 整个读取在 1 次 IIC 顺序读传输中完成：每读满 chunk_size 字节调用 1 次 callback，
+ *       回调期间 SCL 保持低电平、总线暂停，回调返回后在同一传输中继续读取，不重新发送地址；
+ *       RAM 占用只有调用者提供的 chunk 缓冲区
  * @param addr EEPROM 内部数据地址（起始读取地址）
- * @param buf 1 个指针，指向：存放读取到的数据的变量
- * @param length 要读取的字节数
- * @return EEPROM 驱动程序错误码
+ * @param length 要读取的字节数（最大 EEPROM_SIZE_BYTES）
+ * @param chunk 1 个指针，指向：存放每块数据的缓冲区（至少 chunk_size 字节）
+ * @param chunk_size 每块字节数（最后一块可能不足）
+ * @param callback 每块数据的处理函数，返回 0 时提前结束读取
+ * @return EEPROM 驱动程序错误码（回调提前结束读取时返回 EEPROM_OK）
  */
-EEPROM_Error_T EEPROM_ReadMultiByte(uint8_t addr, uint8_t *buf, uint8_t length)
+EEPROM_Error_T EEPROM_ReadStream(uint16_t addr, uint32_t length, uint8_t *chunk, uint8_t chunk_size, EEPROM_Stream_Callback_T callback)
 {
-    iic_states_t iic_state;     //! 用于存储 IIC 状态码
-    uint8_t i;
+    EEPROM_Error_T eeprom_error;    //! 用于存储 EEPROM 错误码
+    iic_states_t iic_state;         //! 用于存储 IIC 状态码
+    uint8_t chunk_length;           //! 当前块已读取的字节数
+    uint8_t dummy;
 
     /* ===================== 参数检查 ===================== */
 
-    /* 内部数据起始地址检查 */
-    if (addr > EEPROM_TOTAL_SIZE_KB)
-    {
-        return EEPROM_ERR_WORD_ADDR;
-    }
-
-    /* 读取字节数检查 */
-    if ((length == 0) || (length > EEPROM_TOTAL_SIZE_KB))
-    {
-        return EEPROM_ERR_DATA_SIZE;
-    }
-
-    /* 待读取的内部数据地址范围检查 */
-    if (addr + length > EEPROM_TOTAL_SIZE_KB)
+    if ((length == 0) || ((uint32_t)addr + length > EEPROM_SIZE_BYTES) || (chunk_size == 0))
     {
         return EEPROM_ERR_DATA_SIZE;
     }
 
     /* ===================== 开始连续读取 ===================== */
 
-    /* START */
-    iic_state = IIC_Start();
-    if(iic_state != IIC_OK)
-    {
-        IIC_Stop();
-        return EEPROM_ERR_IIC;
-    }
-
-    /* 发送 EEPROM 设备地址 + 写 */
-    iic_state = IIC_SendByte(EEPROM_IIC_ADDR);
-    if(iic_state == IIC_ERR_NACK)
-    {
-        IIC_Stop();
-        return EEPROM_ERR_SLAVE_NACK;
-    }
-
-    /* 发送 EEPROM 内部数据地址 */
-    iic_state = IIC_SendByte(addr);
-    if(iic_state == IIC_ERR_NACK)
+    eeprom_error = EEPROM_ReadOpen(addr);
+    if (eeprom_error != EEPROM_OK)
     {
-        IIC_Stop();
-        return EEPROM_ERR_SLAVE_NACK;
+        return eeprom_error;
     }
 
-    /* RESTART */
-    iic_state = IIC_Restart();
-    if(iic_state != IIC_OK)
-    {
-        IIC_Stop();
-        return EEPROM_ERR_IIC;
-    }
+    chunk_length = 0;
 
-    /* 发送 EEPROM 设备地址 + 读 */
-    iic_state = IIC_SendByte(EEPROM_IIC_ADDR | 0x01);
-    if(iic_state == IIC_ERR_NACK)
+    while (length)
     {
-        IIC_Stop();
-        return EEPROM_ERR_SLAVE_NACK;
-    }
+        length --;
 
-    /* 读取 (length-1) 个字节的数据，并在每次读取后发送 ACK */
-    for (i = 0; i < length-1; i++)
-    {
-        iic_state = IIC_ReceiveByte(buf + i, 1);
+        /* 最后 1 个字节发送 NACK，其余字节发送 ACK */
+        iic_state = EEPROM_IIC(ReceiveByte)(&chunk[chunk_length], (length != 0));
         if (iic_state != IIC_OK)
         {
-            IIC_Stop();
+            EEPROM_IIC(Stop)();
             return EEPROM_ERR_IIC;
         }
-    }
 
-    /* 读取最后 1 个字节的数据，并发送 NACK */
-    iic_state = IIC_ReceiveByte(buf + length - 1, 0);
-    if (iic_state != IIC_OK)
-    {
-        IIC_Stop();
-        return EEPROM_ERR_IIC;
+        chunk_length ++;
+
+        /* 块已满或已读完：交给回调处理 */
+        if ((chunk_length == chunk_size) || (length == 0))
+        {
+            if (!callback(chunk, chunk_length) && length)
+            {
+                /* 提前结束：上一字节已应答 ACK，再读 1 个字节并应答 NACK，从机释放 SDA 后才能发送 STOP */
+                EEPROM_IIC(ReceiveByte)(&dummy, 0);
+                break;
+            }
+
+            chunk_length = 0;
+        }
     }
 
     /* STOP */
-    iic_state = IIC_Stop();
+    iic_state = EEPROM_IIC(Stop)();
     if (iic_state != IIC_OK)
     {
-        IIC_Stop();
+        EEPROM_IIC(Stop)();
         return EEPROM_ERR_IIC;
     }
 
     return EEPROM_OK;
 }
 
+/**
+ * @brief 设置 EEPROM_WriteMultiByte() 是否使用比较写入
+ * @note EEPROM_WRITE_COMPARE 为 0 时本函数无效
+ * @param enable 1-先读出比较，只写内容不同的部分；0-直接写入
+ * @return None
+ */
+void EEPROM_Set_CompareWrite(bool enable)
+{
+    #if EEPROM_WRITE_COMPARE
+        eeprom_compare_write = enable;
+    #endif
+}
+
+/**
+ * @brief 获取写入统计信息
+ * @param None
+ * @return 指向写入统计信息的指针
+ */
+EEPROM_Stats_T *EEPROM_Get_Stats(void)
+{
+    return &eeprom_stats;
+}
+
+/**
+ * @brief 清零写入统计信息
+ * @param None
+ * @return None
+ */
+void EEPROM_Clear_Stats(void)
+{
+    eeprom_stats.page_write = 0;
+    eeprom_stats.page_skip = 0;
+    eeprom_stats.byte_skip = 0;
+}
+
 /**
  * @brief ACK 轮询函数，等待内部写完成
+ * @note 总线故障（START 失败）时立即返回 EEPROM_ERR_IIC，不再继续轮询
  * @param None
  * @return EEPROM 驱动程序错误码
  */
 EEPROM_Error_T EEPROM_AckPolling(void)
 {
+    EEPROM_Error_T eeprom_error;
     uint8_t retry = 0;
 
     while (retry < EEPROM_ACK_POLLING_MAX_TRY)
     {
-        //! START
-        IIC_Start();
-
-        //! 发送设备地址 + 写
-        IIC_SendByte(EEPROM_IIC_ADDR);
-
-        //! 如果收到 ACK，说明写完成
-        if (IIC_Wait_ACK() == IIC_OK)
+        eeprom_error = EEPROM_AckProbe();
+        if (eeprom_error != EEPROM_ERR_SLAVE_BUSY)
         {
-            IIC_Stop();
-            return EEPROM_OK;
+            return eeprom_error;
         }
-        
-        //! 未收到 ACK，内部写未完成，停止本次通信，继续轮询
-        IIC_Stop();
+
+        //! 内部写未完成，继续轮询
         delay_10us(10);       //! 短暂延时
         retry ++;
     }
@@ -596,4 +662,111 @@ EEPROM_Error_T EEPROM_AckPolling(void)
     return EEPROM_ERR_SLAVE_BUSY;
 }
 
-/* ========================= 内部函数声明区域 ========================= */
\ No newline at end of file
+/**
+ * @brief 单次 ACK 探测（不等待）
+ * @note 发送 START + 设备地址（写）+ STOP，耗时约 10 个 SCL 时钟；
+ *       START 失败（总线故障或处于退避期）时直接返回，不发送地址和 STOP，退避期间不产生时钟
+ * @param None
+ * @return EEPROM_OK-器件应答（内部写已完成），EEPROM_ERR_SLAVE_BUSY-器件无应答（内部写进行中），
+ *         EEPROM_ERR_IIC-START 失败，无法判断写周期是否完成
+ */
+EEPROM_Error_T EEPROM_AckProbe(void)
+{
+    iic_states_t iic_state;     //! 用于存储 IIC 状态码
+
+    //! START
+    if (EEPROM_IIC(Start)() != IIC_OK)
+    {
+        return EEPROM_ERR_IIC;
+    }
+
+    //! 发送设备地址 + 写，SendByte 内部已等待 ACK，如果收到 ACK，说明写完成
+    iic_state = EEPROM_IIC(SendByte)(EEPROM_IIC_ADDR);
+
+    EEPROM_IIC(Stop)();
+
+    return (iic_state == IIC_OK) ? EEPROM_OK : EEPROM_ERR_SLAVE_BUSY;
+}
+
+/* ========================= 内部函数定义区域 ========================= */
+
+/**
+ * @brief 发送 START + 设备地址（写）+ 内部数据地址
+ * @note 按 EEPROM_ADDR_BYTES 发送 1 或 2 个字地址字节，单字节字地址器件的地址高位放入设备地址的块选择位；
+ *       出错时已发送 STOP
+ * @param addr EEPROM 内部数据地址
+ * @return EEPROM 驱动程序错误码
+ */
+static EEPROM_Error_T EEPROM_SendAddress(uint16_t addr)
+{
+    /* 发送 START */
+    if (EEPROM_IIC(Start)() != IIC_OK)
+    {
+        EEPROM_IIC(Stop)();
+        return EEPROM_ERR_IIC;
+    }
+
+    /* 发送设备地址 + 写 */
+    if (EEPROM_IIC(SendByte)(EEPROM_DEV_ADDR(addr)) == IIC_ERR_NACK)
+    {
+        EEPROM_IIC(Stop)();
+        return EEPROM_ERR_SLAVE_NACK;
+    }
+
+    #if EEPROM_BLOCK_BITS
+        eeprom_last_dev_addr = EEPROM_DEV_ADDR(addr);       //! 记录所在的块，供当前地址读取使用
+    #endif
+
+    /* 发送字地址高字节 */
+    #if EEPROM_ADDR_BYTES == 2
+        if (EEPROM_IIC(SendByte)((uint8_t)(addr >> 8)) == IIC_ERR_NACK)
+        {
+            EEPROM_IIC(Stop)();
+            return EEPROM_ERR_SLAVE_NACK;
+        }
+    #endif
+
+    /* 发送字地址低字节 */
+    if (EEPROM_IIC(SendByte)((uint8_t)addr) == IIC_ERR_NACK)
+    {
+        EEPROM_IIC(Stop)();
+        return EEPROM_ERR_SLAVE_NACK;
+    }
+
+    return EEPROM_OK;
+}
+
+/**
+ * @brief 开始顺序读：发送 START + 设备地址（写）+ 内部数据地址（伪写，设置内部地址计数器）+ RESTART + 设备地址（读）
+ * @note 出错时已发送 STOP
+ * @param addr EEPROM 内部数据地址
+ * @return EEPROM 驱动程序错误码
+ */
+static EEPROM_Error_T EEPROM_ReadOpen(uint16_t addr)
+{
+    EEPROM_Error_T eeprom_error;    //! 用于存储 EEPROM 错误码
+
+    eeprom_error = EEPROM_SendAddress(addr);
+    if (eeprom_error != EEPROM_OK)
+    {
+        return eeprom_error;
+    }
+
+    /* RESTART */
+    if (EEPROM_IIC(Restart)() != IIC_OK)
+    {
+        EEPROM_IIC(Stop)();
+        return EEPROM_ERR_IIC;
+    }
+
+    /* 发送 EEPROM 设备地址 + 读 */
+    if (EEPROM_IIC(SendByte)(EEPROM_DEV_ADDR(addr) | 0x01) == IIC_ERR_NACK)
+    {
+        EEPROM_IIC(Stop)();
+        return EEPROM_ERR_SLAVE_NACK;
+    }
+
+    return EEPROM_OK;
+}
+
+#endif      /* EEPROM_BACKEND == EEPROM_BACKEND_AT24 */
@@ -2,8 +2,8 @@
  * @file    eeprom_hal.h
  * @brief   EEPROM HAL 驱动接口
  * @author  ForeverMySunyu
- * @version 1.0.0
- * @date    2025-12-29
+ * @version 1.4.3
+ * @date    2026-10-18
  */
 
 
@@ -30,9 +30,40 @@ typedef enum
     EEPROM_ERR_SLAVE_BUSY,      //! EEPROM 设备忙
     EEPROM_ERR_SLAVE_NACK,      //! EEPROM 设备无应答
     EEPROM_ERR_VERIFY,          //! 校验失败
+    EEPROM_ERR_NOT_FOUND,       //! 数据不存在
     EEPROM_ERR_UNKNOWN          //! 未知错误
 } EEPROM_Error_T;
 
+/* ================== 写入统计信息 ================== */
+
+/**
+ * @brief EEPROM_WriteMultiByte() 的写入统计（到 0xFFFF 后不再增加）
+ * @note  节省的写周期时间 ≈ page_skip × EEPROM_WRITE_TIME_MS
+ */
+typedef struct
+{
+    uint16_t page_write;    //! 实际执行的页写入次数（内部写周期数）
+    uint16_t page_skip;     //! 内容相同而跳过的页写入次数
+    uint16_t byte_skip;     //! 比较后裁掉、未写入的字节数（含跳过的页）
+} EEPROM_Stats_T;
+
+//! 统计计数器 counter 增加 n（到 0xFFFF 后不再增加），两个 EEPROM 后端共用；按 uint16_t 相加，回绕即溢出
+#define EEPROM_STAT_ADD(counter, n)                                                                         \
+    do {                                                                                                    \
+        (counter) = ((uint16_t)((counter) + (uint16_t)(n)) < (uint16_t)(counter)) ?                         \
+                    0xFFFFu : (uint16_t)((counter) + (uint16_t)(n));                                        \
+    } while (0)
+
+/* ================== 流式读取回调 ================== */
+
+/**
+ * @brief EEPROM_ReadStream() 的数据块处理函数
+ * @param chunk 本块数据
+ * @param length 本块字节数
+ * @return 1-继续读取，0-提前结束
+ */
+typedef bool (*EEPROM_Stream_Callback_T)(uint8_t *chunk, uint8_t length);
+
 /* ========================= API 函数声明区域 ========================= */
 
 /**
@@ -48,31 +79,45 @@ EEPROM_Error_T EEPROM_Init_hal(void);
  * @param write_byte 要写入的 1 字节数据
  * @return EEPROM 驱动程序错误码
  */
-EEPROM_Error_T EEPROM_ByteWrite(uint8_t addr, uint8_t write_byte);
+EEPROM_Error_T EEPROM_ByteWrite(uint16_t addr, uint8_t write_byte);
 
 /**
  * @brief 页写入函数
- * @note 单页写入，不能跨页
+ * @note 单页写入，不能跨页；返回前通过 ACK 轮询等待内部写周期完成
  * @param page_num 页数，保存数据的页地址（从 0 开始计数）
  * @param row_num 行数，在该页的第几行中开始保存数据（从 0 开始计数）
  * @param buf 1 个指针，指向：存放要写入数据的变量
  * @param length 要写入的字节数
  * @return EEPROM 驱动程序错误码
  */
-EEPROM_Error_T EEPROM_PageWrite(uint8_t page_num, uint8_t row_num, uint8_t *buf, uint8_t length);
+EEPROM_Error_T EEPROM_PageWrite(uint16_t page_num, uint8_t row_num, uint8_t *buf, uint8_t length);
+
+/**
+ * @brief 页发送函数（不等待写周期）
+ * @note 单页写入，不能跨页；发送 STOP 后立即返回，内部写周期是否完成由 EEPROM_AckProbe() 查询
+ * @param page_num 页数，保存数据的页地址（从 0 开始计数）
+ * @param row_num 行数，在该页的第几行中开始保存数据（从 0 开始计数）
+ * @param buf 1 个指针，指向：存放要写入数据的变量
+ * @param length 要写入的字节数
+ * @return EEPROM 驱动程序错误码
+ */
+EEPROM_Error_T EEPROM_PageSend(uint16_t page_num, uint8_t row_num, uint8_t *buf, uint8_t length);
 
 /**
  * @brief  多字节连续写入
- * @note 自动分页
+ * @note 自动分页，每页只消耗 1 次内部写周期
+ * @note 启用比较写入时，每页先读出比较，内容相同的页不写，不同的页只写最小的不同字节区间
  * @param addr EEPROM 内部数据地址（起始存储地址）
  * @param buf 1 个指针，指向：存放要写入数据的变量
  * @param length 要写入的字节数
  * @return EEPROM 驱动程序错误码
  */
-EEPROM_Error_T EEPROM_WriteMultiByte(uint8_t addr, uint8_t *buf, uint8_t length);
+EEPROM_Error_T EEPROM_WriteMultiByte(uint16_t addr, uint8_t *buf, uint16_t length);
 
 /**
  * @brief 从当前地址读取1字节
+ * @note 器件内部地址计数器指向上次访问的下一字节；有块选择位的器件（AT24C04/08/16）发送最近一次寻址所在块的设备地址，
+ *       上次访问恰好结束在块的最后一个字节时，计数器已进入下一块，此时应改用 EEPROM_ByteRead()
  * @param buf 1 个指针，指向：存放读取到的数据的变量
  * @return EEPROM 驱动程序错误码
  */
@@ -84,7 +129,7 @@ EEPROM_Error_T EEPROM_ReadCurrentByte(uint8_t *buf);
  * @param read_byte 1 个指针，指向用于存储读取到的 1 字节数据的变量
  * @return EEPROM 驱动程序错误码
  */
-EEPROM_Error_T EEPROM_ByteRead(uint8_t addr, uint8_t *read_byte);
+EEPROM_Error_T EEPROM_ByteRead(uint16_t addr, uint8_t *read_byte);
 
 /**
  * @brief 页读取函数
@@ -95,22 +140,78 @@ EEPROM_Error_T EEPROM_ByteRead(uint8_t addr, uint8_t *read_byte);
  * @param length 要读取的字节数
  * @return EEPROM 驱动程序错误码
  */
-EEPROM_Error_T EEPROM_PageRead(uint8_t page_num, uint8_t row_num, uint8_t *buf, uint8_t length);
+EEPROM_Error_T EEPROM_PageRead(uint16_t page_num, uint8_t row_num, uint8_t *buf, uint8_t length);
 
 /**
  * @brief 多字节连续读取
+ * @note 顺序读取，不受页边界限制，整个读取在 1 次 IIC 传输中完成
  * @param addr EEPROM 内部数据地址（起始读取地址）
  * @param buf 1 个指针，指向：存放读取到的数据的变量
  * @param length 要读取的字节数
  * @return EEPROM 驱动程序错误码
  */
-EEPROM_Error_T EEPROM_ReadMultiByte(uint8_t addr, uint8_t *buf, uint8_t length);
+EEPROM_Error_T EEPROM_ReadMultiByte(uint16_t addr, uint8_t *buf, uint16_t length);
+
+/**
+ * @brief 流式连续读取
+ * @note 整个读取在 1 次 IIC 顺序读传输中完成，每读满 chunk_size 字节调用 1 次 callback，
+ *       块与块之间不重新发送地址；RAM 占用只有 chunk 缓冲区，适合把整片数据转发到串口
+ * @note 回调执行期间总线暂停（SCL 保持低电平），总线上的平均速率 = 块字节数 / (块读取时间 + 回调时间)
+ * @param addr EEPROM 内部数据地址（起始读取地址）
+ * @param length 要读取的字节数（最大 EEPROM_SIZE_BYTES）
+ * @param chunk 1 个指针，指向：存放每块数据的缓冲区（至少 chunk_size 字节）
+ * @param chunk_size 每块字节数（最后一块可能不足）
+ * @param callback 每块数据的处理函数，返回 0 时提前结束读取
+ * @return EEPROM 驱动程序错误码（回调提前结束读取时返回 EEPROM_OK）
+ *
+ * @code{.c}
+ * static bool dump_chunk(uint8_t *chunk, uint8_t length)
+ * {
+ *     while (length --)   uart_send_byte_hal(*chunk ++);
+ *     return 1;
+ * }
+ *
+ * uint8_t chunk[16];
+ * EEPROM_ReadStream(0, EEPROM_SIZE_BYTES, chunk, sizeof(chunk), dump_chunk);
+ * @endcode
+ */
+EEPROM_Error_T EEPROM_ReadStream(uint16_t addr, uint32_t length, uint8_t *chunk, uint8_t chunk_size, EEPROM_Stream_Callback_T callback);
+
+/**
+ * @brief 设置 EEPROM_WriteMultiByte() 是否使用比较写入
+ * @note EEPROM_WRITE_COMPARE 为 0 时本函数无效
+ * @param enable 1-先读出比较，只写内容不同的部分；0-直接写入
+ * @return None
+ */
+void EEPROM_Set_CompareWrite(bool enable);
+
+/**
+ * @brief 获取写入统计信息
+ * @param None
+ * @return 指向写入统计信息的指针
+ */
+EEPROM_Stats_T *EEPROM_Get_Stats(void);
+
+/**
+ * @brief 清零写入统计信息
+ * @param None
+ * @return None
+ */
+void EEPROM_Clear_Stats(void);
 
 /**
  * @brief ACK 轮询函数，等待内部写完成
  * @param None
- * @return EEPROM 驱动程序错误码
+ * @return EEPROM_OK-写周期已完成，EEPROM_ERR_SLAVE_BUSY-轮询超时，EEPROM_ERR_IIC-总线故障（START 失败）
  */
 EEPROM_Error_T EEPROM_AckPolling(void);
 
+/**
+ * @brief 单次 ACK 探测（不等待）
+ * @param None
+ * @return EEPROM_OK-器件应答（内部写已完成），EEPROM_ERR_SLAVE_BUSY-器件无应答（内部写进行中），
+ *         EEPROM_ERR_IIC-总线故障（START 失败，未发送地址）
+ */
+EEPROM_Error_T EEPROM_AckProbe(void);
+
 #endif      /* _EEPROM_HAL_H_ */
\ No newline at end of file
@@ -0,0 +1,535 @@
+/**
+ * @file    eeprom_iap_hal.c
+ * @brief   EEPROM HAL 驱动源文件（片内 IAP 数据 Flash 模拟后端）
+ * @author  ForeverMySunyu
+ * @version 1.0.1
+ * @date    2026-10-18
+ *
+ * @details
+ *  - EEPROM_BACKEND 为 EEPROM_BACKEND_IAP 时生效，提供与 eeprom_hal.c 相同的 EEPROM_* 接口
+ *  - 模拟的 EEPROM 内容完整保存在 xdata 影子缓冲区中，读取只是内存拷贝，不经过任何总线
+ *  - 2 个扇区交替使用，扇区末尾 2 字节为标记：序号 + 序号取反，标记有效的扇区中序号较新的为当前扇区
+ *  - 写入时与影子比较：
+ *      1. 内容相同的字节不写
+ *      2. 只需把 1 写成 0 的字节直接在当前扇区编程（无需擦除）
+ *      3. 有字节需要把 0 恢复成 1 时换页：擦除备用扇区，写入全部数据，最后写标记，备用扇区成为当前扇区
+ *  - 换页过程中掉电：备用扇区标记未写入，上电后仍使用原扇区（只丢失本次写入）
+ *  - 页写入/页发送在返回前 Flash 操作已完成，EEPROM_AckProbe()/EEPROM_AckPolling() 总是返回 EEPROM_OK
+ */
+
+#include "../config/eeprom_configuration.h"
+#include "../bsp/iap_bsp.h"
+#include "eeprom_hal.h"
+
+#if (EEPROM_BACKEND == EEPROM_BACKEND_IAP)
+
+#if (EEPROM_SIZE_BYTES > IAP_SECTOR_SIZE - 2)
+    #error "EEPROM_SIZE_BYTES must not exceed 510 for the IAP backend"
+#endif
+
+#if (EEPROM_IAP_SECTOR_A % IAP_SECTOR_SIZE) || (EEPROM_IAP_SECTOR_B % IAP_SECTOR_SIZE) || (EEPROM_IAP_SECTOR_A == EEPROM_IAP_SECTOR_B)
+    #error "EEPROM_IAP_SECTOR_A and EEPROM_IAP_SECTOR_B must be two different 512-byte aligned sectors"
+#endif
+
+/* ========================= 扇区格式 ========================= */
+
+//! 扇区 sector（0-A，1-B）的起始地址
+#define IAP_SECTOR_ADDR(sector)     ((sector) ? EEPROM_IAP_SECTOR_B : EEPROM_IAP_SECTOR_A)
+
+//! 扇区 sector 的标记地址（序号，下一字节为序号取反）
+#define IAP_MARK_ADDR(sector)       (IAP_SECTOR_ADDR(sector) + IAP_SECTOR_SIZE - 2)
+
+/* ========================= 模拟状态 ========================= */
+
+static EEPROM_Stats_T eeprom_stats = {0};                   //! 写入统计信息
+static uint8_t xdata eeprom_shadow[EEPROM_SIZE_BYTES];      //! 模拟 EEPROM 的影子缓冲区
+static uint8_t eeprom_sector = 0;                           //! 当前扇区（0-A，1-B）
+static uint8_t eeprom_seq = 0;                              //! 当前扇区的序号
+static uint16_t eeprom_current_addr = 0;                    //! EEPROM_ReadCurrentByte() 的当前地址
+
+/* ========================= 内部函数声明区域 ========================= */
+
+static EEPROM_Error_T EEPROM_IAP_Write(uint16_t addr, uint8_t *buf, uint16_t length);
+static void EEPROM_IAP_Swap(void);
+static bool EEPROM_IAP_MarkValid(uint8_t sector, uint8_t *seq);
+
+/* ========================= API 函数定义区域 ========================= */
+
+/**
+ * @brief EEPROM 初始化函数
+ * @details 选出当前扇区并读入影子缓冲区；两个扇区都无效时格式化扇区 A（内容全为 0xFF，与空白 EEPROM 相同）
+ * @return EEPROM 驱动程序错误码
+ */
+EEPROM_Error_T EEPROM_Init_hal(void)
+{
+    uint8_t seq_a, seq_b;
+    bool valid_a, valid_b;
+    uint16_t i;
+
+    valid_a = EEPROM_IAP_MarkValid(0, &seq_a);
+    valid_b = EEPROM_IAP_MarkValid(1, &seq_b);
+
+    if (valid_a && valid_b)
+    {
+        /* 换页后未擦除原扇区：序号较新的为当前扇区 */
+        eeprom_sector = ((int8_t)(seq_b - seq_a) > 0) ? 1 : 0;
+        eeprom_seq = eeprom_sector ? seq_b : seq_a;
+    }
+    else if (valid_a || valid_b)
+    {
+        eeprom_sector = valid_b ? 1 : 0;
+        eeprom_seq = valid_b ? seq_b : seq_a;
+    }
+    else
+    {
+        /* 格式化：擦除扇区 A，写入标记 */
+        IAP_EraseSector(IAP_SECTOR_ADDR(0));
+        IAP_ProgramByte(IAP_MARK_ADDR(0), 0);
+        IAP_ProgramByte(IAP_MARK_ADDR(0) + 1, 0xFF);
+
+        if (!EEPROM_IAP_MarkValid(0, &seq_a))
+        {
+            return EEPROM_ERR_WRITE;
+        }
+
+        eeprom_sector = 0;
+        eeprom_seq = 0;
+    }
+
+    for (i = 0; i < EEPROM_SIZE_BYTES; i++)
+    {
+        eeprom_shadow[i] = IAP_ReadByte(IAP_SECTOR_ADDR(eeprom_sector) + i);
+    }
+
+    return EEPROM_OK;
+}
+
+/**
+ * @brief 单字节写入
+ * @param addr EEPROM 内部数据地址
+ * @param write_byte 要写入的 1 字节数据
+ * @return EEPROM 驱动程序错误码
+ */
+EEPROM_Error_T EEPROM_ByteWrite(uint16_t addr, uint8_t write_byte)
+{
+    /* 内部数据地址参数检查 */
+    if (addr >= EEPROM_SIZE_BYTES)
+    {
+        return EEPROM_ERR_WORD_ADDR;
+    }
+
+    return EEPROM_IAP_Write(addr, &write_byte, 1);
+}
+
+/**
+ * @brief 页写入函数
+ * @note 单页写入，不能跨页（页大小沿用 EEPROM_PAGE_SIZE，便于与 AT24Cxx 后端互换）
+ * @param page_num 页数，保存数据的页地址（从 0 开始计数）
+ * @param row_num 行数，在该页的第几行中开始保存数据（从 0 开始计数）
+ * @param buf 1 个指针，指向：存放要写入数据的变量
+ * @param length 要写入的字节数
+ * @return EEPROM 驱动程序错误码
+ */
+EEPROM_Error_T EEPROM_PageWrite(uint16_t page_num, uint8_t row_num, uint8_t *buf, uint8_t length)
+{
+    return EEPROM_PageSend(page_num, row_num, buf, length);
+}
+
+/**
+ * @brief 页发送函数
+ * @note 与 EEPROM_PageWrite() 相同，返回时 Flash 操作已完成
+ * @param page_num 页数，保存数据的页地址（从 0 开始计数）
+ * @param row_num 行数，在该页的第几行中开始保存数据（从 0 开始计数）
+ * @param buf 1 个指针，指向：存放要写入数据的变量
+ * @param length 要写入的字节数
+ * @return EEPROM 驱动程序错误码
+ */
+EEPROM_Error_T EEPROM_PageSend(uint16_t page_num, uint8_t row_num, uint8_t *buf, uint8_t length)
+{
+    /* 页数参数检查 */
+    if (page_num >= EEPROM_PAGE_NUM)
+    {
+        return EEPROM_ERR_PAGE_NUM;
+    }
+
+    /* 行数参数检查 */
+    if (row_num >= EEPROM_PAGE_SIZE)
+    {
+        return EEPROM_ERR_ROW_NUM;
+    }
+
+    /* 写入字节数检查 */
+    if ((length == 0) || (length > EEPROM_PAGE_SIZE-row_num))
+    {
+        return EEPROM_ERR_DATA_SIZE;
+    }
+
+    return EEPROM_IAP_Write(page_num * EEPROM_PAGE_SIZE + row_num, buf, length);
+}
+
+/**
+ * @brief  多字节连续写入
+ * @note 按页统计写入信息；整个区间最多换页 1 次
+ * @param addr EEPROM 内部数据地址（起始存储地址）
+ * @param buf 1 个指针，指向：存放要写入数据的变量
+ * @param length 要写入的字节数
+ * @return EEPROM 驱动程序错误码
+ */
+EEPROM_Error_T EEPROM_WriteMultiByte(uint16_t addr, uint8_t *buf, uint16_t length)
+{
+    uint16_t offset;
+    uint8_t row_num, write_length, diff;
+    uint8_t i;
+
+    /* ===================== 参数检查 ===================== */
+
+    /* 内部数据起始地址检查 */
+    if (addr >= EEPROM_SIZE_BYTES)
+    {
+        return EEPROM_ERR_WORD_ADDR;
+    }
+
+    /* 写入字节数检查 */
+    if ((length == 0) || ((uint32_t)addr + length > EEPROM_SIZE_BYTES))
+    {
+        return EEPROM_ERR_DATA_SIZE;
+    }
+
+    /* ===================== 按页统计（与影子比较，不访问 Flash） ===================== */
+
+    for (offset = 0; offset < length; offset += write_length)
+    {
+        row_num = (addr + offset) % EEPROM_PAGE_SIZE;
+        write_length = EEPROM_PAGE_SIZE - row_num;
+        if (write_length > length - offset)
+        {
+            write_length = length - offset;
+        }
+
+        for (diff = 0, i = 0; i < write_length; i++)
+        {
+            if (eeprom_shadow[addr + offset + i] != buf[offset + i])
+            {
+                diff ++;
+            }
+        }
+
+        if (diff)
+        {
+            EEPROM_STAT_ADD(eeprom_stats.page_write, 1);
+        }
+        else
+        {
+            EEPROM_STAT_ADD(eeprom_stats.page_skip, 1);
+        }
+        EEPROM_STAT_ADD(eeprom_stats.byte_skip, write_length - diff);
+    }
+
+    return EEPROM_IAP_Write(addr, buf, length);
+}
+
+/**
+ * @brief 从当前地址读取1字节
+ * @note 当前地址为上一次读取的最后一个字节的下一个地址，到末尾后回到 0
+ * @param buf 1 个指针，指向：存放读取到的数据的变量
+ * @return EEPROM 驱动程序错误码
+ */
+EEPROM_Error_T EEPROM_ReadCurrentByte(uint8_t *read_byte)
+{
+    *read_byte = eeprom_shadow[eeprom_current_addr];
+
+    eeprom_current_addr = (eeprom_current_addr + 1) % EEPROM_SIZE_BYTES;
+
+    return EEPROM_OK;
+}
+
+/**
+ * @brief 单字节读取（随机读取）
+ * @param addr EEPROM 内部数据地址
+ * @param read_byte 1 个指针，指向用于存储读取到的 1 字节数据的变量
+ * @return EEPROM 驱动程序错误码
+ */
+EEPROM_Error_T EEPROM_ByteRead(uint16_t addr, uint8_t *read_byte)
+{
+    /* 内部数据地址参数检查 */
+    if (addr >= EEPROM_SIZE_BYTES)
+    {
+        return EEPROM_ERR_WORD_ADDR;
+    }
+
+    return EEPROM_ReadMultiByte(addr, read_byte, 1);
+}
+
+/**
+ * @brief 页读取函数
+ * @note 单页读取，不能跨页
+ * @param page_num 页数，读取数据的页地址（从 0 开始计数）
+ * @param row_num 行数，在该页的第几行中开始读取数据（从 0 开始计数）
+ * @param buf 1 个指针，指向：存放读取到的数据的变量
+ * @param length 要读取的字节数
+ * @return EEPROM 驱动程序错误码
+ */
+EEPROM_Error_T EEPROM_PageRead(uint16_t page_num, uint8_t row_num, uint8_t *buf, uint8_t length)
+{
+    /* 页数参数检查 */
+    if (page_num >= EEPROM_PAGE_NUM)
+    {
+        return EEPROM_ERR_PAGE_NUM;
+    }
+
+    /* 行数参数检查 */
+    if (row_num >= EEPROM_PAGE_SIZE)
+    {
+        return EEPROM_ERR_ROW_NUM;
+    }
+
+    /* 读取字节数检查 */
+    if ((length == 0) || (length > EEPROM_PAGE_SIZE-row_num))
+    {
+        return EEPROM_ERR_DATA_SIZE;
+    }
+
+    return EEPROM_ReadMultiByte(page_num * EEPROM_PAGE_SIZE + row_num, buf, length);
+}
+
+/**
+ * @brief 多字节连续读取
+ * @note 从影子缓冲区拷贝，不受页边界限制
+ * @param addr EEPROM 内部数据地址（起始读取地址）
+ * @param buf 1 个指针，指向：存放读取到的数据的变量
+ * @param length 要读取的字节数
+ * @return EEPROM 驱动程序错误码
+ */
+EEPROM_Error_T EEPROM_ReadMultiByte(uint16_t addr, uint8_t *buf, uint16_t length)
+{
+    /* 内部数据起始地址检查 */
+    if (addr >= EEPROM_SIZE_BYTES)
+    {
+        return EEPROM_ERR_WORD_ADDR;
+    }
+
+    /* 读取字节数与地址范围检查 */
+    if ((length == 0) || ((uint32_t)addr + length > EEPROM_SIZE_BYTES))
+    {
+        return EEPROM_ERR_DATA_SIZE;
+    }
+
+    while (length --)
+    {
+        *buf ++ = eeprom_shadow[addr ++];
+    }
+
+    eeprom_current_addr = addr % EEPROM_SIZE_BYTES;
+
+    return EEPROM_OK;
+}
+
+/**
+ * @brief 流式连续读取
+ * @note 从影子缓冲区按块拷贝，每读满 chunk_size 字节调用 1 次 callback
+ * @param addr EEPROM 内部数据地址（起始读取地址）
+ * @param length 要读取的字节数（最大 EEPROM_SIZE_BYTES）
+ * @param chunk 1 个指针，指向：存放每块数据的缓冲区（至少 chunk_size 字节）
+ * @param chunk_size 每块字节数（最后一块可能不足）
+ * @param callback 每块数据的处理函数，返回 0 时提前结束读取
+ * @return EEPROM 驱动程序错误码（回调提前结束读取时返回 EEPROM_OK）
+ */
+EEPROM_Error_T EEPROM_ReadStream(uint16_t addr, uint32_t length, uint8_t *chunk, uint8_t chunk_size, EEPROM_Stream_Callback_T callback)
+{
+    uint8_t chunk_length;
+
+    /* 参数检查 */
+    if ((length == 0) || ((uint32_t)addr + length > EEPROM_SIZE_BYTES) || (chunk_size == 0))
+    {
+        return EEPROM_ERR_DATA_SIZE;
+    }
+
+    while (length)
+    {
+        chunk_length = (length > chunk_size) ? chunk_size : (uint8_t)length;
+
+        EEPROM_ReadMultiByte(addr, chunk, chunk_length);
+        addr += chunk_length;
+        length -= chunk_length;
+
+        if (!callback(chunk, chunk_length))
+        {
+            break;
+        }
+    }
+
+    return EEPROM_OK;
+}
+
+/**
+ * @brief 设置 EEPROM_WriteMultiByte() 是否使用比较写入
+ * @note IAP 后端总是与影子缓冲区比较（不访问 Flash），本函数无效
+ * @param enable 1-先读出比较，只写内容不同的部分；0-直接写入
+ * @return None
+ */
+void EEPROM_Set_CompareWrite(bool enable)
+{
+    (void)enable;
+}
+
+/**
+ * @brief 获取写入统计信息
+ * @param None
+ * @return 指向写入统计信息的指针
+ */
+EEPROM_Stats_T *EEPROM_Get_Stats(void)
+{
+    return &eeprom_stats;
+}
+
+/**
+ * @brief 清零写入统计信息
+ * @param None
+ * @return None
+ */
+void EEPROM_Clear_Stats(void)
+{
+    eeprom_stats.page_write = 0;
+    eeprom_stats.page_skip = 0;
+    eeprom_stats.byte_skip = 0;
+}
+
+/**
+ * @brief ACK 轮询函数，等待内部写完成
+ * @note IAP 写入返回时已完成，直接返回 EEPROM_OK
+ * @param None
+ * @return EEPROM 驱动程序错误码
+ */
+EEPROM_Error_T EEPROM_AckPolling(void)
+{
+    return EEPROM_OK;
+}
+
+/**
+ * @brief 单次 ACK 探测（不等待）
+ * @note IAP 写入返回时已完成，直接返回 EEPROM_OK
+ * @param None
+ * @return EEPROM_OK-写入已完成
+ */
+EEPROM_Error_T EEPROM_AckProbe(void)
+{
+    return EEPROM_OK;
+}
+
+/* ========================= 内部函数定义区域 ========================= */
+
+/**
+ * @brief 写入模拟 EEPROM（参数已检查）
+ * @param addr EEPROM 内部数据地址（起始存储地址）
+ * @param buf 1 个指针，指向：存放要写入数据的变量
+ * @param length 要写入的字节数
+ * @return EEPROM 驱动程序错误码
+ */
+static EEPROM_Error_T EEPROM_IAP_Write(uint16_t addr, uint8_t *buf, uint16_t length)
+{
+    uint16_t flash_addr = IAP_SECTOR_ADDR(eeprom_sector) + addr;
+    uint16_t i;
+    bool swap = 0;
+
+    /* ===================== 比较：是否有字节需要把 0 恢复成 1 ===================== */
+
+    for (i = 0; i < length; i++)
+    {
+        if ((eeprom_shadow[addr + i] & buf[i]) != buf[i])
+        {
+            swap = 1;
+            break;
+        }
+    }
+
+    /* ===================== 只需把 1 写成 0：在当前扇区直接编程 ===================== */
+
+    for (i = 0; (i < length) && !swap; i++)
+    {
+        if (eeprom_shadow[addr + i] != buf[i])
+        {
+            IAP_ProgramByte(flash_addr + i, buf[i]);
+
+            /* 编程后读回不一致（例如该字节已磨损）：改为换页 */
+            if (IAP_ReadByte(flash_addr + i) != buf[i])
+            {
+                swap = 1;
+            }
+
+            eeprom_shadow[addr + i] = buf[i];
+        }
+    }
+
+    if (!swap)
+    {
+        return EEPROM_OK;
+    }
+
+    /* ===================== 换页：更新影子后整体写入备用扇区 ===================== */
+
+    for (i = 0; i < length; i++)
+    {
+        eeprom_shadow[addr + i] = buf[i];
+    }
+
+    EEPROM_IAP_Swap();
+
+    /* 校验备用扇区是否已成为当前扇区 */
+    for (i = 0; i < length; i++)
+    {
+        if (IAP_ReadByte(IAP_SECTOR_ADDR(eeprom_sector) + addr + i) != buf[i])
+        {
+            return EEPROM_ERR_WRITE;
+        }
+    }
+
+    return EEPROM_OK;
+}
+
+/**
+ * @brief 换页：擦除备用扇区，写入影子缓冲区，最后写标记
+ * @note 擦除后全为 0xFF，影子中为 0xFF 的字节不需要编程
+ * @param None
+ * @return None
+ */
+static void EEPROM_IAP_Swap(void)
+{
+    uint8_t spare = eeprom_sector ^ 0x01;
+    uint8_t seq = eeprom_seq + 1;
+    uint16_t i;
+
+    IAP_EraseSector(IAP_SECTOR_ADDR(spare));
+
+    for (i = 0; i < EEPROM_SIZE_BYTES; i++)
+    {
+        if (eeprom_shadow[i] != 0xFF)
+        {
+            IAP_ProgramByte(IAP_SECTOR_ADDR(spare) + i, eeprom_shadow[i]);
+        }
+    }
+
+    /* 标记最后写入，之前掉电时原扇区仍是当前扇区 */
+    IAP_ProgramByte(IAP_MARK_ADDR(spare), seq);
+    IAP_ProgramByte(IAP_MARK_ADDR(spare) + 1, (uint8_t)~seq);
+
+    eeprom_sector = spare;
+    eeprom_seq = seq;
+}
+
+/**
+ * @brief 读取扇区标记
+ * @param sector 扇区（0-A，1-B）
+ * @param seq 用于返回序号
+ * @return 1-标记有效，0-标记无效（空白或写入未完成）
+ */
+static bool EEPROM_IAP_MarkValid(uint8_t sector, uint8_t *seq)
+{
+    uint8_t inverse;
+
+    *seq = IAP_ReadByte(IAP_MARK_ADDR(sector));
+    inverse = (uint8_t)~(*seq);             //! 先截断为 8 位再比较（避免与整型提升后的取反值比较）
+
+    return (IAP_ReadByte(IAP_MARK_ADDR(sector) + 1) == inverse);
+}
+
+#endif      /* EEPROM_BACKEND == EEPROM_BACKEND_IAP */
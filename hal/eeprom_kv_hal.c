@@ -0,0 +1,560 @@
+/**
+ * @file    eeprom_kv_hal.c
+ * @brief   EEPROM 键值存储（日志结构、磨损均衡）HAL 源文件
+ * @author  ForeverMySunyu
+ * @version 1.0.1
+ * @date    2026-10-18
+ *
+ * @details
+ *  - 扇区头（6 字节）：'K' 'V' + 扇区代号（uint16，低字节在前）+ CRC16（前 4 字节）
+ *  - 记录（4 + 长度 字节）：键 + 长度 + CRC16（扇区代号、键、长度、数据）+ 数据；长度为 0 表示删除
+ *  - 扇区按环形顺序使用，代号每打开一个扇区加 1：当前扇区的下一个是备用扇区（不含有效记录），
+ *    再下一个是最旧的扇区；打开备用扇区时把最旧扇区中的有效记录搬过来，它就成为新的备用扇区
+ *  - 记录不跨页：页内剩余空间放不下时从下一页开始；扫描时遇到页中间的无效记录跳到下一页开头，
+ *    页开头的无效记录表示扇区内的记录到此结束
+ */
+
+#include <stddef.h>
+#include "../config/eeprom_configuration.h"
+#include "../core/crc.h"
+#include "eeprom_hal.h"
+#include "eeprom_kv_hal.h"
+
+#if (EEPROM_KV_BASE_ADDR % EEPROM_PAGE_SIZE) || (EEPROM_KV_SECTOR_SIZE % EEPROM_PAGE_SIZE)
+    #error "EEPROM_KV_BASE_ADDR and EEPROM_KV_SECTOR_SIZE must be multiples of EEPROM_PAGE_SIZE"
+#endif
+
+#if (EEPROM_KV_SECTOR_NUM < 2) || (EEPROM_KV_SECTOR_NUM > 8)
+    #error "EEPROM_KV_SECTOR_NUM must be between 2 and 8"
+#endif
+
+#if (EEPROM_KV_BASE_ADDR + EEPROM_KV_SECTOR_SIZE * EEPROM_KV_SECTOR_NUM * 1UL) > EEPROM_SIZE_BYTES
+    #error "EEPROM key/value area exceeds EEPROM_SIZE_BYTES"
+#endif
+
+#if (EEPROM_KV_VALUE_MAX < 1) || (EEPROM_KV_VALUE_MAX > EEPROM_PAGE_SIZE - 4)
+    #error "EEPROM_KV_VALUE_MAX must be between 1 and EEPROM_PAGE_SIZE-4"
+#endif
+
+//! 回收一定成功的条件：全部键的最新记录加 1 条新记录（每条按 2 倍长度计算页尾浪费）放得进 1 个扇区
+#if ((EEPROM_KV_KEY_NUM + 1) * 2 * (EEPROM_KV_VALUE_MAX + 4) + 6) > EEPROM_KV_SECTOR_SIZE
+    #error "EEPROM_KV_SECTOR_SIZE is too small for EEPROM_KV_KEY_NUM keys of EEPROM_KV_VALUE_MAX bytes"
+#endif
+
+/* ========================= 存储格式 ========================= */
+
+#define KV_SECTOR_HDR_SIZE      6           //! 扇区头字节数
+#define KV_REC_HDR_SIZE         4           //! 记录头字节数
+#define KV_MAGIC_0              'K'         //! 扇区头标志
+#define KV_MAGIC_1              'V'
+#define KV_NONE                 0xFFFF      //! 索引中表示键不存在
+
+//! 扇区 s 的起始地址
+#define KV_SECTOR_ADDR(s)       ((uint16_t)(EEPROM_KV_BASE_ADDR + (uint16_t)(s) * EEPROM_KV_SECTOR_SIZE))
+//! 地址 addr 所在的扇区
+#define KV_SECTOR_OF(addr)      ((uint8_t)(((addr) - EEPROM_KV_BASE_ADDR) / EEPROM_KV_SECTOR_SIZE))
+
+/* ========================= 存储状态 ========================= */
+
+static uint16_t xdata kv_index[EEPROM_KV_KEY_NUM];                  //! 各键最新记录的地址（KV_NONE 表示不存在）
+static uint8_t xdata kv_length[EEPROM_KV_KEY_NUM];                  //! 各键最新记录的值长度
+static uint8_t xdata kv_buf[KV_REC_HDR_SIZE + EEPROM_KV_VALUE_MAX]; //! 记录缓冲区
+static uint8_t kv_active = 0;                                       //! 当前扇区
+static uint16_t kv_gen = 0;                                         //! 当前扇区代号
+static uint16_t kv_wp = 0;                                          //! 当前扇区内下一条记录的偏移
+
+/* ========================= 内部函数声明区域 ========================= */
+
+static EEPROM_Error_T KV_ReadSectorGen(uint8_t sector, uint16_t *gen);
+static EEPROM_Error_T KV_OpenSector(uint8_t sector, uint16_t gen);
+static EEPROM_Error_T KV_ScanSector(uint8_t sector, uint16_t gen, uint16_t *end);
+static EEPROM_Error_T KV_Evacuate(uint8_t sector);
+static EEPROM_Error_T KV_Append(uint8_t key, const uint8_t *value, uint8_t length);
+static EEPROM_Error_T KV_WriteRecord(void);
+static uint16_t KV_Place(uint8_t size);
+static uint16_t KV_RecordCRC(uint16_t gen);
+
+/* ========================= API 函数定义区域 ========================= */
+
+/**
+ * @brief 挂载键值存储
+ * @note 扫描全部扇区并建立 RAM 索引；存储区中没有有效扇区时自动格式化；
+ *       上次回收中途掉电时，在此完成回收
+ * @param None
+ * @return EEPROM 驱动程序错误码
+ */
+EEPROM_Error_T EEPROM_KV_Mount(void)
+{
+    EEPROM_Error_T eeprom_error;
+    uint16_t gen[EEPROM_KV_SECTOR_NUM];
+    uint8_t valid = 0;              //! 扇区头有效的扇区（按位）
+    uint8_t sector, next, i;
+    uint16_t end = KV_SECTOR_HDR_SIZE;      //! 当前扇区最后一条有效记录之后的偏移（未扫描到记录时为数据区起始）
+
+    for (i = 0; i < EEPROM_KV_KEY_NUM; i++)
+    {
+        kv_index[i] = KV_NONE;
+    }
+
+    /* ===================== 读取全部扇区头 ===================== */
+
+    for (sector = 0; sector < EEPROM_KV_SECTOR_NUM; sector++)
+    {
+        eeprom_error = KV_ReadSectorGen(sector, &gen[sector]);
+        if (eeprom_error == EEPROM_OK)
+        {
+            valid |= (uint8_t)(0x01 << sector);
+        }
+        else if (eeprom_error != EEPROM_ERR_VERIFY)
+        {
+            return eeprom_error;
+        }
+    }
+
+    if (valid == 0)
+    {
+        return EEPROM_KV_Format();
+    }
+
+    /* ===================== 确定当前扇区：下一个扇区的代号不是本扇区代号 +1 ===================== */
+
+    kv_active = EEPROM_KV_SECTOR_NUM;
+    for (sector = 0; sector < EEPROM_KV_SECTOR_NUM; sector++)
+    {
+        if (!(valid & (0x01 << sector)))
+        {
+            continue;
+        }
+
+        if (kv_active == EEPROM_KV_SECTOR_NUM)
+        {
+            kv_active = sector;
+        }
+
+        next = (sector + 1) % EEPROM_KV_SECTOR_NUM;
+        if (!(valid & (0x01 << next)) || (gen[next] != (uint16_t)(gen[sector] + 1)))
+        {
+            kv_active = sector;
+            break;
+        }
+    }
+
+    kv_gen = gen[kv_active];
+
+    /* ===================== 从最旧到最新扫描各扇区，较新的记录覆盖索引 ===================== */
+
+    for (i = 1; i <= EEPROM_KV_SECTOR_NUM; i++)
+    {
+        sector = (kv_active + i) % EEPROM_KV_SECTOR_NUM;
+        if (!(valid & (0x01 << sector)))
+        {
+            continue;
+        }
+
+        eeprom_error = KV_ScanSector(sector, gen[sector], &end);
+        if (eeprom_error != EEPROM_OK)
+        {
+            return eeprom_error;
+        }
+    }
+
+    kv_wp = end;        //! 当前扇区有效，总是最后扫描；其中没有记录时从数据区起始写入
+
+    /* 备用扇区中仍有有效记录：上次回收中途掉电，继续搬移 */
+    return KV_Evacuate((kv_active + 1) % EEPROM_KV_SECTOR_NUM);
+}
+
+/**
+ * @brief 格式化键值存储（删除全部键）
+ * @param None
+ * @return EEPROM 驱动程序错误码
+ */
+EEPROM_Error_T EEPROM_KV_Format(void)
+{
+    EEPROM_Error_T eeprom_error;
+    uint8_t sector;
+    uint16_t gen;
+    uint16_t new_gen = 0;
+    uint8_t i;
+
+    /* 新代号大于现有全部扇区的代号，旧记录全部失效 */
+    for (sector = 0; sector < EEPROM_KV_SECTOR_NUM; sector++)
+    {
+        if ((KV_ReadSectorGen(sector, &gen) == EEPROM_OK) && ((uint16_t)(gen + 1) > new_gen))
+        {
+            new_gen = gen + 1;
+        }
+    }
+
+    /* 作废其他扇区的扇区头 */
+    kv_buf[0] = 0;
+    kv_buf[1] = 0;
+    for (sector = 1; sector < EEPROM_KV_SECTOR_NUM; sector++)
+    {
+        eeprom_error = EEPROM_PageWrite(KV_SECTOR_ADDR(sector) / EEPROM_PAGE_SIZE, 0, kv_buf, 2);
+        if (eeprom_error != EEPROM_OK)
+        {
+            return eeprom_error;
+        }
+    }
+
+    for (i = 0; i < EEPROM_KV_KEY_NUM; i++)
+    {
+        kv_index[i] = KV_NONE;
+    }
+
+    return KV_OpenSector(0, new_gen);
+}
+
+/**
+ * @brief 写入（追加）1 个键的值
+ * @param key 键（0 ~ EEPROM_KV_KEY_NUM-1）
+ * @param value 1 个指针，指向：要写入的值
+ * @param length 值的字节数（1 ~ EEPROM_KV_VALUE_MAX）
+ * @return EEPROM 驱动程序错误码
+ */
+EEPROM_Error_T EEPROM_KV_Set(uint8_t key, const uint8_t *value, uint8_t length)
+{
+    if (key >= EEPROM_KV_KEY_NUM)
+    {
+        return EEPROM_ERR_WORD_ADDR;
+    }
+
+    if ((length == 0) || (length > EEPROM_KV_VALUE_MAX))
+    {
+        return EEPROM_ERR_DATA_SIZE;
+    }
+
+    return KV_Append(key, value, length);
+}
+
+/**
+ * @brief 读取 1 个键的值
+ * @param key 键（0 ~ EEPROM_KV_KEY_NUM-1）
+ * @param value 1 个指针，指向：存放读取到的值的缓冲区
+ * @param size 缓冲区大小（字节），值更长时只读取前 size 字节
+ * @param length 用于返回值的实际字节数，可为 NULL
+ * @return EEPROM 驱动程序错误码
+ */
+EEPROM_Error_T EEPROM_KV_Get(uint8_t key, uint8_t *value, uint8_t size, uint8_t *length)
+{
+    uint8_t read_length;
+
+    if (key >= EEPROM_KV_KEY_NUM)
+    {
+        return EEPROM_ERR_WORD_ADDR;
+    }
+
+    if (kv_index[key] == KV_NONE)
+    {
+        return EEPROM_ERR_NOT_FOUND;
+    }
+
+    if (length != NULL)
+    {
+        *length = kv_length[key];
+    }
+
+    read_length = (kv_length[key] < size) ? kv_length[key] : size;
+    if (read_length == 0)
+    {
+        return EEPROM_OK;
+    }
+
+    return EEPROM_ReadMultiByte(kv_index[key] + KV_REC_HDR_SIZE, value, read_length);
+}
+
+/**
+ * @brief 删除 1 个键
+ * @param key 键（0 ~ EEPROM_KV_KEY_NUM-1）
+ * @return EEPROM 驱动程序错误码（键不存在时直接返回 EEPROM_OK）
+ */
+EEPROM_Error_T EEPROM_KV_Delete(uint8_t key)
+{
+    if (key >= EEPROM_KV_KEY_NUM)
+    {
+        return EEPROM_ERR_WORD_ADDR;
+    }
+
+    if (kv_index[key] == KV_NONE)
+    {
+        return EEPROM_OK;
+    }
+
+    return KV_Append(key, NULL, 0);
+}
+
+/* ========================= 内部函数定义区域 ========================= */
+
+/**
+ * @brief 读取并校验扇区头
+ * @param sector 扇区号
+ * @param gen 用于返回扇区代号
+ * @return EEPROM_OK-扇区头有效，EEPROM_ERR_VERIFY-扇区头无效，其他-读取失败
+ */
+static EEPROM_Error_T KV_ReadSectorGen(uint8_t sector, uint16_t *gen)
+{
+    EEPROM_Error_T eeprom_error;
+
+    eeprom_error = EEPROM_ReadMultiByte(KV_SECTOR_ADDR(sector), kv_buf, KV_SECTOR_HDR_SIZE);
+    if (eeprom_error != EEPROM_OK)
+    {
+        return eeprom_error;
+    }
+
+    if ((kv_buf[0] != KV_MAGIC_0) || (kv_buf[1] != KV_MAGIC_1) ||
+        (crc16_ccitt(CRC16_CCITT_INIT, kv_buf, 4) != (kv_buf[4] | ((uint16_t)kv_buf[5] << 8))))
+    {
+        return EEPROM_ERR_VERIFY;
+    }
+
+    *gen = kv_buf[2] | ((uint16_t)kv_buf[3] << 8);
+
+    return EEPROM_OK;
+}
+
+/**
+ * @brief 打开扇区：写入扇区头，并设为当前扇区
+ * @param sector 扇区号
+ * @param gen 扇区代号
+ * @return EEPROM 驱动程序错误码
+ */
+static EEPROM_Error_T KV_OpenSector(uint8_t sector, uint16_t gen)
+{
+    EEPROM_Error_T eeprom_error;
+    uint16_t crc;
+
+    kv_buf[0] = KV_MAGIC_0;
+    kv_buf[1] = KV_MAGIC_1;
+    kv_buf[2] = (uint8_t)gen;
+    kv_buf[3] = (uint8_t)(gen >> 8);
+    crc = crc16_ccitt(CRC16_CCITT_INIT, kv_buf, 4);
+    kv_buf[4] = (uint8_t)crc;
+    kv_buf[5] = (uint8_t)(crc >> 8);
+
+    eeprom_error = EEPROM_PageWrite(KV_SECTOR_ADDR(sector) / EEPROM_PAGE_SIZE, 0, kv_buf, KV_SECTOR_HDR_SIZE);
+    if (eeprom_error != EEPROM_OK)
+    {
+        return eeprom_error;
+    }
+
+    kv_active = sector;
+    kv_gen = gen;
+    kv_wp = KV_SECTOR_HDR_SIZE;
+
+    return EEPROM_OK;
+}
+
+/**
+ * @brief 扫描扇区中的记录，用有效记录更新索引
+ * @param sector 扇区号
+ * @param gen 扇区代号
+ * @param end 用于返回最后一条有效记录之后的偏移
+ * @return EEPROM 驱动程序错误码
+ */
+static EEPROM_Error_T KV_ScanSector(uint8_t sector, uint16_t gen, uint16_t *end)
+{
+    EEPROM_Error_T eeprom_error;
+    uint16_t offset = KV_SECTOR_HDR_SIZE;
+    uint16_t addr;
+    uint8_t page_left;      //! 页内剩余字节数
+    uint8_t key, length;
+
+    while ((uint16_t)(offset + KV_REC_HDR_SIZE) <= (uint16_t)EEPROM_KV_SECTOR_SIZE)
+    {
+        addr = KV_SECTOR_ADDR(sector) + offset;
+        page_left = EEPROM_PAGE_SIZE - (addr % EEPROM_PAGE_SIZE);
+
+        /* 记录不跨页：1 次读取页内剩余部分（最多 1 条最长记录） */
+        length = (page_left < sizeof(kv_buf)) ? page_left : sizeof(kv_buf);
+        eeprom_error = EEPROM_ReadMultiByte(addr, kv_buf, length);
+        if (eeprom_error != EEPROM_OK)
+        {
+            return eeprom_error;
+        }
+
+        key = kv_buf[0];
+        length = kv_buf[1];
+
+        if ((key < EEPROM_KV_KEY_NUM) && (length <= EEPROM_KV_VALUE_MAX) &&
+            (KV_REC_HDR_SIZE + length <= page_left) &&
+            (KV_RecordCRC(gen) == (kv_buf[2] | ((uint16_t)kv_buf[3] << 8))))
+        {
+            kv_index[key] = length ? addr : KV_NONE;
+            kv_length[key] = length;
+            offset += KV_REC_HDR_SIZE + length;
+        }
+        else if (addr % EEPROM_PAGE_SIZE)
+        {
+            /* 页中间的无效数据：写入时因放不下而跳到了下一页 */
+            offset += page_left;
+        }
+        else
+        {
+            break;
+        }
+    }
+
+    *end = offset;
+
+    return EEPROM_OK;
+}
+
+/**
+ * @brief 把扇区中仍有效的记录搬到当前扇区
+ * @param sector 扇区号
+ * @return EEPROM 驱动程序错误码
+ */
+static EEPROM_Error_T KV_Evacuate(uint8_t sector)
+{
+    EEPROM_Error_T eeprom_error;
+    uint8_t key;
+
+    for (key = 0; key < EEPROM_KV_KEY_NUM; key++)
+    {
+        if ((kv_index[key] == KV_NONE) || (KV_SECTOR_OF(kv_index[key]) != sector))
+        {
+            continue;
+        }
+
+        eeprom_error = EEPROM_ReadMultiByte(kv_index[key], kv_buf, KV_REC_HDR_SIZE + kv_length[key]);
+        if (eeprom_error != EEPROM_OK)
+        {
+            return eeprom_error;
+        }
+
+        if (KV_Place(KV_REC_HDR_SIZE + kv_length[key]) == KV_NONE)
+        {
+            return EEPROM_ERR_DATA_SIZE;
+        }
+
+        eeprom_error = KV_WriteRecord();
+        if (eeprom_error != EEPROM_OK)
+        {
+            return eeprom_error;
+        }
+    }
+
+    return EEPROM_OK;
+}
+
+/**
+ * @brief 追加 1 条记录，当前扇区放不下时打开下一个扇区并回收最旧的扇区
+ * @param key 键
+ * @param value 值（length 为 0 时不使用）
+ * @param length 值的字节数，0 表示删除
+ * @return EEPROM 驱动程序错误码
+ */
+static EEPROM_Error_T KV_Append(uint8_t key, const uint8_t *value, uint8_t length)
+{
+    EEPROM_Error_T eeprom_error;
+    uint8_t sector;
+    uint8_t i;
+
+    for (i = 0; KV_Place(KV_REC_HDR_SIZE + length) == KV_NONE; i++)
+    {
+        if (i >= EEPROM_KV_SECTOR_NUM)
+        {
+            return EEPROM_ERR_DATA_SIZE;
+        }
+
+        sector = (kv_active + 1) % EEPROM_KV_SECTOR_NUM;
+
+        eeprom_error = KV_OpenSector(sector, kv_gen + 1);
+        if (eeprom_error != EEPROM_OK)
+        {
+            return eeprom_error;
+        }
+
+        eeprom_error = KV_Evacuate((sector + 1) % EEPROM_KV_SECTOR_NUM);
+        if (eeprom_error != EEPROM_OK)
+        {
+            return eeprom_error;
+        }
+    }
+
+    /* 回收过程使用 kv_buf，回收完成后再组装记录 */
+    kv_buf[0] = key;
+    kv_buf[1] = length;
+    for (i = 0; i < length; i++)
+    {
+        kv_buf[KV_REC_HDR_SIZE + i] = value[i];
+    }
+
+    return KV_WriteRecord();
+}
+
+/**
+ * @brief 把 kv_buf 中的记录写到当前扇区的写入位置（1 次页写入），并更新索引
+ * @note 调用前已由 KV_Place() 确认放得下并调整了写入位置
+ * @param None
+ * @return EEPROM 驱动程序错误码
+ */
+static EEPROM_Error_T KV_WriteRecord(void)
+{
+    EEPROM_Error_T eeprom_error;
+    uint16_t addr = KV_SECTOR_ADDR(kv_active) + kv_wp;
+    uint8_t key = kv_buf[0];
+    uint8_t length = kv_buf[1];
+    uint16_t crc;
+
+    crc = KV_RecordCRC(kv_gen);
+    kv_buf[2] = (uint8_t)crc;
+    kv_buf[3] = (uint8_t)(crc >> 8);
+
+    eeprom_error = EEPROM_PageWrite(addr / EEPROM_PAGE_SIZE, addr % EEPROM_PAGE_SIZE, kv_buf, KV_REC_HDR_SIZE + length);
+    if (eeprom_error != EEPROM_OK)
+    {
+        return eeprom_error;
+    }
+
+    kv_index[key] = length ? addr : KV_NONE;
+    kv_length[key] = length;
+    kv_wp += KV_REC_HDR_SIZE + length;
+
+    return EEPROM_OK;
+}
+
+/**
+ * @brief 为 size 字节的记录确定写入位置（页内放不下时移到下一页开头）
+ * @param size 记录字节数
+ * @return 写入位置在扇区内的偏移，当前扇区放不下时返回 KV_NONE（不修改写入位置）
+ */
+static uint16_t KV_Place(uint8_t size)
+{
+    uint16_t offset = kv_wp;
+    uint8_t page_left = EEPROM_PAGE_SIZE - ((KV_SECTOR_ADDR(kv_active) + offset) % EEPROM_PAGE_SIZE);
+
+    if (size > page_left)
+    {
+        offset += page_left;
+    }
+
+    if (offset + size > EEPROM_KV_SECTOR_SIZE)
+    {
+        return KV_NONE;
+    }
+
+    kv_wp = offset;
+
+    return offset;
+}
+
+/**
+ * @brief 计算 kv_buf 中记录的 CRC（扇区代号 + 键 + 长度 + 数据）
+ * @param gen 扇区代号
+ * @return CRC 值
+ */
+static uint16_t KV_RecordCRC(uint16_t gen)
+{
+    uint8_t gen_bytes[2];
+    uint16_t crc;
+
+    gen_bytes[0] = (uint8_t)gen;
+    gen_bytes[1] = (uint8_t)(gen >> 8);
+
+    crc = crc16_ccitt(CRC16_CCITT_INIT, gen_bytes, 2);
+    crc = crc16_ccitt(crc, kv_buf, 2);
+
+    return crc16_ccitt(crc, &kv_buf[KV_REC_HDR_SIZE], kv_buf[1]);
+}
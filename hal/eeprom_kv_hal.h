@@ -0,0 +1,81 @@
+/**
+ * @file    eeprom_kv_hal.h
+ * @brief   EEPROM 键值存储（日志结构、磨损均衡）HAL 接口
+ * @author  ForeverMySunyu
+ * @version 1.0.0
+ * @date    2026-10-18
+ *
+ * @details
+ *  - 每次更新在存储区末尾追加 1 条记录（键 + 长度 + CRC16 + 数据），不再反复改写固定地址，
+ *    擦写次数分散到整个存储区
+ *  - 挂载时扫描全部扇区，在 RAM 中为每个键记录其最新记录的地址，之后的读取 O(1) 定位
+ *  - 记录不跨页，1 次更新只消耗 1 次页写入；当前扇区写满时打开下一个扇区，
+ *    并把再下一个扇区（最旧的扇区）中仍有效的记录搬到新扇区，之后该扇区可被覆盖
+ *  - 记录的 CRC 包含扇区代号，扇区被重新使用后其中的旧记录自动失效；写入中途掉电的记录校验失败，被忽略
+ *
+ * @attention 存储区范围（EEPROM_KV_BASE_ADDR 开始的 EEPROM_KV_SECTOR_NUM 个扇区）不要再用其他接口写入
+ *
+ * @code{.c}
+ * EEPROM_KV_Mount();
+ * if (EEPROM_KV_Get(KEY_VOLUME, &volume, sizeof(volume), &length) != EEPROM_OK)
+ * {
+ *     volume = 5;                              // 默认值
+ * }
+ * EEPROM_KV_Set(KEY_VOLUME, &volume, sizeof(volume));
+ * @endcode
+ */
+
+#ifndef _EEPROM_KV_HAL_H_
+#define _EEPROM_KV_HAL_H_
+
+#include "stdint.h"
+#include "stdbool.h"
+#include "eeprom_hal.h"
+
+/* ========================= API 函数声明区域 ========================= */
+
+/**
+ * @brief 挂载键值存储
+ * @note 扫描全部扇区并建立 RAM 索引；存储区中没有有效扇区时自动格式化；
+ *       上次回收中途掉电时，在此完成回收
+ * @param None
+ * @return EEPROM 驱动程序错误码
+ */
+EEPROM_Error_T EEPROM_KV_Mount(void);
+
+/**
+ * @brief 格式化键值存储（删除全部键）
+ * @param None
+ * @return EEPROM 驱动程序错误码
+ */
+EEPROM_Error_T EEPROM_KV_Format(void);
+
+/**
+ * @brief 写入（追加）1 个键的值
+ * @param key 键（0 ~ EEPROM_KV_KEY_NUM-1）
+ * @param value 1 个指针，指向：要写入的值
+ * @param length 值的字节数（1 ~ EEPROM_KV_VALUE_MAX）
+ * @return EEPROM 驱动程序错误码
+ */
+EEPROM_Error_T EEPROM_KV_Set(uint8_t key, const uint8_t *value, uint8_t length);
+
+/**
+ * @brief 读取 1 个键的值
+ * @param key 键（0 ~ EEPROM_KV_KEY_NUM-1）
+ * @param value 1 个指针，指向：存放读取到的值的缓冲区
+ * @param size 缓冲区大小（字节），值更长时只读取前 size 字节
+ * @param length 用于返回值的实际字节数，可为 NULL
+ * @return EEPROM 驱动程序错误码
+ * @retval EEPROM_OK - 读取成功
+ *         EEPROM_ERR_NOT_FOUND - 该键不存在
+ */
+EEPROM_Error_T EEPROM_KV_Get(uint8_t key, uint8_t *value, uint8_t size, uint8_t *length);
+
+/**
+ * @brief 删除 1 个键
+ * @param key 键（0 ~ EEPROM_KV_KEY_NUM-1）
+ * @return EEPROM 驱动程序错误码（键不存在时直接返回 EEPROM_OK）
+ */
+EEPROM_Error_T EEPROM_KV_Delete(uint8_t key);
+
+#endif      /* _EEPROM_KV_HAL_H_ */
@@ -0,0 +1,491 @@
+/**
+ * @file    eeprom_log_hal.c
+ * @brief   EEPROM 循环日志（定长记录）HAL 源文件
+ * @author  ForeverMySunyu
+ * @version 1.0.0
+ * @date    2026-10-18
+ *
+ * @details
+ *  - 块格式：序号(2) + 记录数(1) + CRC16(2，序号、记录数和全部记录) + 记录 × 记录数
+ *  - 记录格式：时间戳(4，低字节在前) + 数据(EEPROM_LOG_DATA_SIZE)
+ *  - 第 k 圈写入日志区第 i 块时，块序号 = 起始序号 + k * EEPROM_LOG_BLOCK_NUM + i，
+ *    因此"第 i 块有效且序号 = 第 0 块序号 + i"对本圈已写入的块成立、对之后的块不成立，可以二分查找
+ *  - 只有最新块（块缓冲区对应的块）可能未写满；清空日志时序号跳过 EEPROM_LOG_BLOCK_NUM + 1，旧块全部失效
+ */
+
+#include <stddef.h>
+#include "../config/eeprom_configuration.h"
+#include "../core/crc.h"
+#include "eeprom_hal.h"
+#include "eeprom_log_hal.h"
+
+#if (EEPROM_LOG_BLOCK_SIZE % EEPROM_PAGE_SIZE) || (EEPROM_LOG_BLOCK_SIZE > 255)
+    #error "EEPROM_LOG_BLOCK_SIZE must be a multiple of EEPROM_PAGE_SIZE and at most 255"
+#endif
+
+#if (EEPROM_LOG_BASE_ADDR % EEPROM_LOG_BLOCK_SIZE)
+    #error "EEPROM_LOG_BASE_ADDR must be a multiple of EEPROM_LOG_BLOCK_SIZE"
+#endif
+
+#if (EEPROM_LOG_BLOCK_NUM < 2) || (EEPROM_LOG_BLOCK_NUM > 2048)
+    #error "EEPROM_LOG_BLOCK_NUM must be between 2 and 2048"
+#endif
+
+#if (EEPROM_LOG_BASE_ADDR + EEPROM_LOG_BLOCK_NUM * EEPROM_LOG_BLOCK_SIZE * 1UL) > EEPROM_SIZE_BYTES
+    #error "EEPROM log area exceeds EEPROM_SIZE_BYTES"
+#endif
+
+#if (EEPROM_LOG_BLOCK_SIZE < 5 + 4 + EEPROM_LOG_DATA_SIZE)
+    #error "EEPROM_LOG_BLOCK_SIZE is too small for one log record"
+#endif
+
+/* ========================= 日志格式 ========================= */
+
+#define LOG_HDR_SIZE            5                                                   //! 块头字节数
+#define LOG_REC_SIZE            (4 + EEPROM_LOG_DATA_SIZE)                          //! 每条记录字节数
+#define LOG_PER_BLOCK           ((EEPROM_LOG_BLOCK_SIZE - LOG_HDR_SIZE) / LOG_REC_SIZE) //! 每块记录数
+
+//! 日志区第 block 块的起始地址
+#define LOG_BLOCK_ADDR(block)   ((uint16_t)(EEPROM_LOG_BASE_ADDR + (uint16_t)(block) * EEPROM_LOG_BLOCK_SIZE))
+
+/* ========================= 日志状态 ========================= */
+
+static uint8_t xdata log_buf[EEPROM_LOG_BLOCK_SIZE];     //! 块缓冲区（最新块）
+static uint16_t log_head = 0;                       //! 最新块在日志区中的块号
+static uint16_t log_seq = 0;                        //! 最新块的序号
+static uint8_t log_count = 0;                       //! 最新块中的记录数
+static bool log_wrapped = 0;                        //! 日志区是否已写满一圈（最旧块为最新块的下一块）
+
+/* ========================= 内部函数声明区域 ========================= */
+
+static EEPROM_Error_T LOG_ReadBlock(uint16_t block, uint16_t *seq);
+static EEPROM_Error_T LOG_WriteBlock(void);
+static uint16_t LOG_BlockCRC(void);
+static uint16_t LOG_FullBlocks(void);
+
+/* ========================= API 函数定义区域 ========================= */
+
+/**
+ * @brief 挂载日志：二分查找最新块，恢复写入位置
+ * @param None
+ * @return EEPROM 驱动程序错误码
+ */
+EEPROM_Error_T EEPROM_Log_Mount(void)
+{
+    EEPROM_Error_T eeprom_error;
+    uint16_t seq0, seq;
+    uint16_t lo, hi, mid;
+    uint16_t last;
+    uint8_t count;
+
+    log_head = 0;
+    log_count = 0;
+    log_wrapped = 0;
+
+    /* ===================== 以第 0 块为基准 ===================== */
+
+    eeprom_error = LOG_ReadBlock(0, &seq0);
+    if (eeprom_error == EEPROM_ERR_VERIFY)
+    {
+        /* 第 0 块无效：日志为空，或绕回第 0 块时写入中途掉电（此时最后一块有效） */
+        eeprom_error = LOG_ReadBlock(EEPROM_LOG_BLOCK_NUM - 1, &seq);
+        if (eeprom_error == EEPROM_ERR_VERIFY)
+        {
+            /* 沿用最后一块块头中的序号（清空日志时写入），新序号不会与残留的旧块相同 */
+            log_seq = log_buf[0] | ((uint16_t)log_buf[1] << 8);
+            return EEPROM_OK;
+        }
+        if (eeprom_error != EEPROM_OK)
+        {
+            return eeprom_error;
+        }
+
+        log_seq = seq;
+        last = EEPROM_LOG_BLOCK_NUM - 1;
+        count = LOG_PER_BLOCK;
+    }
+    else if (eeprom_error != EEPROM_OK)
+    {
+        return eeprom_error;
+    }
+    else
+    {
+        /* ===================== 二分查找本圈写入的最后一块 ===================== */
+
+        lo = 1;
+        hi = EEPROM_LOG_BLOCK_NUM;
+        while (lo < hi)
+        {
+            mid = lo + (hi - lo) / 2;
+
+            eeprom_error = LOG_ReadBlock(mid, &seq);
+            if ((eeprom_error != EEPROM_OK) && (eeprom_error != EEPROM_ERR_VERIFY))
+            {
+                return eeprom_error;
+            }
+
+            if ((eeprom_error == EEPROM_OK) && (seq == (uint16_t)(seq0 + mid)))
+            {
+                lo = mid + 1;
+            }
+            else
+            {
+                hi = mid;
+            }
+        }
+
+        last = lo - 1;
+
+        eeprom_error = LOG_ReadBlock(last, &seq);
+        if (eeprom_error != EEPROM_OK)
+        {
+            return eeprom_error;
+        }
+
+        count = log_buf[2];
+        log_seq = seq;
+    }
+
+    /* ===================== 最后一块未满则继续写该块，否则从下一块开始 ===================== */
+
+    if (count < LOG_PER_BLOCK)
+    {
+        log_head = last;
+    }
+    else
+    {
+        log_head = (last + 1) % EEPROM_LOG_BLOCK_NUM;
+        log_seq ++;
+        count = 0;
+    }
+
+    /* 最新块的下一块是上一圈写入的块：日志区已写满一圈 */
+    eeprom_error = LOG_ReadBlock((log_head + 1) % EEPROM_LOG_BLOCK_NUM, &seq);
+    if ((eeprom_error != EEPROM_OK) && (eeprom_error != EEPROM_ERR_VERIFY))
+    {
+        return eeprom_error;
+    }
+    log_wrapped = (eeprom_error == EEPROM_OK) && (seq == (uint16_t)(log_seq - EEPROM_LOG_BLOCK_NUM + 1));
+
+    /* 重新读入最新块中已有的记录 */
+    if (count)
+    {
+        eeprom_error = LOG_ReadBlock(log_head, &seq);
+        if (eeprom_error != EEPROM_OK)
+        {
+            return eeprom_error;
+        }
+    }
+
+    log_count = count;
+
+    return EEPROM_OK;
+}
+
+/**
+ * @brief 清空日志
+ * @note 新序号跳过 EEPROM_LOG_BLOCK_NUM + 1，旧块的序号全部不连续；
+ *       先作废最后一块（块头记下新序号，第 0 块写入中途掉电时挂载沿用该序号），再写入空的第 0 块
+ * @param None
+ * @return EEPROM 驱动程序错误码
+ */
+EEPROM_Error_T EEPROM_Log_Clear(void)
+{
+    EEPROM_Error_T eeprom_error;
+
+    log_head = 0;
+    log_seq += EEPROM_LOG_BLOCK_NUM + 1;
+    log_count = 0;
+    log_wrapped = 0;
+
+    /* 记录数 0xFF 的块头一定无效 */
+    log_buf[0] = (uint8_t)log_seq;
+    log_buf[1] = (uint8_t)(log_seq >> 8);
+    log_buf[2] = 0xFF;
+    eeprom_error = EEPROM_PageWrite(LOG_BLOCK_ADDR(EEPROM_LOG_BLOCK_NUM - 1) / EEPROM_PAGE_SIZE, 0, log_buf, 3);
+    if (eeprom_error != EEPROM_OK)
+    {
+        return eeprom_error;
+    }
+
+    return LOG_WriteBlock();
+}
+
+/**
+ * @brief 追加 1 条记录
+ * @note 块缓冲区满时写入 EEPROM，否则只写入 RAM
+ * @param timestamp 时间戳（单调不减）
+ * @param dat 1 个指针，指向：EEPROM_LOG_DATA_SIZE 字节的记录数据
+ * @return EEPROM 驱动程序错误码
+ */
+EEPROM_Error_T EEPROM_Log_Append(uint32_t timestamp, const uint8_t *dat)
+{
+    EEPROM_Error_T eeprom_error;
+    uint8_t *rec = &log_buf[LOG_HDR_SIZE + log_count * LOG_REC_SIZE];
+    uint8_t i;
+
+    rec[0] = (uint8_t)timestamp;
+    rec[1] = (uint8_t)(timestamp >> 8);
+    rec[2] = (uint8_t)(timestamp >> 16);
+    rec[3] = (uint8_t)(timestamp >> 24);
+    for (i = 0; i < EEPROM_LOG_DATA_SIZE; i++)
+    {
+        rec[4 + i] = dat[i];
+    }
+
+    log_count ++;
+    if (log_count < LOG_PER_BLOCK)
+    {
+        return EEPROM_OK;
+    }
+
+    /* ===================== 块已满：写入并开始下一块 ===================== */
+
+    eeprom_error = LOG_WriteBlock();
+    if (eeprom_error != EEPROM_OK)
+    {
+        log_count --;
+        return eeprom_error;
+    }
+
+    log_head = (log_head + 1) % EEPROM_LOG_BLOCK_NUM;
+    if (log_head == 0)
+    {
+        log_wrapped = 1;
+    }
+    log_seq ++;
+    log_count = 0;
+
+    return EEPROM_OK;
+}
+
+/**
+ * @brief 把块缓冲区中尚未写入的记录写入 EEPROM
+ * @param None
+ * @return EEPROM 驱动程序错误码
+ */
+EEPROM_Error_T EEPROM_Log_Flush(void)
+{
+    if (log_count == 0)
+    {
+        return EEPROM_OK;
+    }
+
+    return LOG_WriteBlock();
+}
+
+/**
+ * @brief 获取保留的记录条数（含块缓冲区中的记录）
+ * @param None
+ * @return 记录条数
+ */
+uint32_t EEPROM_Log_Count(void)
+{
+    return (uint32_t)LOG_FullBlocks() * LOG_PER_BLOCK + log_count;
+}
+
+/**
+ * @brief 按记录编号读取 1 条记录
+ * @param index 记录编号（0 为最旧的保留记录）
+ * @param timestamp 用于返回时间戳，可为 NULL
+ * @param dat 1 个指针，指向：存放记录数据的缓冲区（EEPROM_LOG_DATA_SIZE 字节），可为 NULL
+ * @return EEPROM 驱动程序错误码
+ */
+EEPROM_Error_T EEPROM_Log_Read(uint32_t index, uint32_t *timestamp, uint8_t *dat)
+{
+    EEPROM_Error_T eeprom_error;
+    uint16_t block = index / LOG_PER_BLOCK;     //! 从最旧块开始的第几块
+    uint8_t row = index % LOG_PER_BLOCK;        //! 块内第几条
+    uint16_t addr;
+    uint8_t ts[4];
+    uint8_t *rec;
+    uint8_t i;
+
+    if (index >= EEPROM_Log_Count())
+    {
+        return EEPROM_ERR_NOT_FOUND;
+    }
+
+    if (block == LOG_FullBlocks())
+    {
+        /* ===================== 位于块缓冲区 ===================== */
+
+        rec = &log_buf[LOG_HDR_SIZE + row * LOG_REC_SIZE];
+        for (i = 0; i < 4; i++)
+        {
+            ts[i] = rec[i];
+        }
+        if (dat != NULL)
+        {
+            for (i = 0; i < EEPROM_LOG_DATA_SIZE; i++)
+            {
+                dat[i] = rec[4 + i];
+            }
+        }
+    }
+    else
+    {
+        /* ===================== 位于 EEPROM ===================== */
+
+        if (log_wrapped)
+        {
+            block = (log_head + 1 + block) % EEPROM_LOG_BLOCK_NUM;
+        }
+
+        addr = LOG_BLOCK_ADDR(block) + LOG_HDR_SIZE + row * LOG_REC_SIZE;
+
+        eeprom_error = EEPROM_ReadMultiByte(addr, ts, 4);
+        if (eeprom_error != EEPROM_OK)
+        {
+            return eeprom_error;
+        }
+
+        if (dat != NULL)
+        {
+            eeprom_error = EEPROM_ReadMultiByte(addr + 4, dat, EEPROM_LOG_DATA_SIZE);
+            if (eeprom_error != EEPROM_OK)
+            {
+                return eeprom_error;
+            }
+        }
+    }
+
+    if (timestamp != NULL)
+    {
+        *timestamp = ts[0] | ((uint32_t)ts[1] << 8) | ((uint32_t)ts[2] << 16) | ((uint32_t)ts[3] << 24);
+    }
+
+    return EEPROM_OK;
+}
+
+/**
+ * @brief 按时间戳查找：第一条时间戳 >= timestamp 的记录
+ * @note 对记录编号二分查找，只读取 O(log n) 条记录的时间戳
+ * @param timestamp 时间戳
+ * @param index 用于返回记录编号
+ * @return EEPROM 驱动程序错误码
+ */
+EEPROM_Error_T EEPROM_Log_SeekTime(uint32_t timestamp, uint32_t *index)
+{
+    EEPROM_Error_T eeprom_error;
+    uint32_t lo = 0;
+    uint32_t hi = EEPROM_Log_Count();
+    uint32_t mid;
+    uint32_t mid_time;
+
+    while (lo < hi)
+    {
+        mid = lo + (hi - lo) / 2;
+
+        eeprom_error = EEPROM_Log_Read(mid, &mid_time, NULL);
+        if (eeprom_error != EEPROM_OK)
+        {
+            return eeprom_error;
+        }
+
+        if (mid_time < timestamp)
+        {
+            lo = mid + 1;
+        }
+        else
+        {
+            hi = mid;
+        }
+    }
+
+    if (lo == EEPROM_Log_Count())
+    {
+        return EEPROM_ERR_NOT_FOUND;
+    }
+
+    *index = lo;
+
+    return EEPROM_OK;
+}
+
+/* ========================= 内部函数定义区域 ========================= */
+
+/**
+ * @brief 读取日志区的 1 块到块缓冲区并校验
+ * @param block 日志区块号
+ * @param seq 用于返回块序号
+ * @return EEPROM_OK-块有效，EEPROM_ERR_VERIFY-块无效，其他-读取失败
+ */
+static EEPROM_Error_T LOG_ReadBlock(uint16_t block, uint16_t *seq)
+{
+    EEPROM_Error_T eeprom_error;
+
+    eeprom_error = EEPROM_ReadMultiByte(LOG_BLOCK_ADDR(block), log_buf, EEPROM_LOG_BLOCK_SIZE);
+    if (eeprom_error != EEPROM_OK)
+    {
+        return eeprom_error;
+    }
+
+    if ((log_buf[2] > LOG_PER_BLOCK) || (LOG_BlockCRC() != (log_buf[3] | ((uint16_t)log_buf[4] << 8))))
+    {
+        return EEPROM_ERR_VERIFY;
+    }
+
+    *seq = log_buf[0] | ((uint16_t)log_buf[1] << 8);
+
+    return EEPROM_OK;
+}
+
+/**
+ * @brief 填写块头并把块缓冲区写入最新块（只写已用部分）
+ * @param None
+ * @return EEPROM 驱动程序错误码
+ */
+static EEPROM_Error_T LOG_WriteBlock(void)
+{
+    EEPROM_Error_T eeprom_error;
+    uint16_t crc;
+    uint8_t offset;
+    uint8_t length;
+    uint8_t total = LOG_HDR_SIZE + log_count * LOG_REC_SIZE;
+
+    log_buf[0] = (uint8_t)log_seq;
+    log_buf[1] = (uint8_t)(log_seq >> 8);
+    log_buf[2] = log_count;
+    crc = LOG_BlockCRC();
+    log_buf[3] = (uint8_t)crc;
+    log_buf[4] = (uint8_t)(crc >> 8);
+
+    /* 逐页写入（页大小 >= EEPROM_LOG_BLOCK_SIZE 时只有 1 次页写入），中途掉电由块 CRC 发现 */
+    for (offset = 0; offset < total; offset += length)
+    {
+        length = ((total - offset) > EEPROM_PAGE_SIZE) ? EEPROM_PAGE_SIZE : (total - offset);
+
+        eeprom_error = EEPROM_PageWrite((LOG_BLOCK_ADDR(log_head) + offset) / EEPROM_PAGE_SIZE, 0, &log_buf[offset], length);
+        if (eeprom_error != EEPROM_OK)
+        {
+            return eeprom_error;
+        }
+    }
+
+    return EEPROM_OK;
+}
+
+/**
+ * @brief 计算块缓冲区的 CRC（序号、记录数和全部记录）
+ * @param None
+ * @return CRC 值
+ */
+static uint16_t LOG_BlockCRC(void)
+{
+    uint16_t crc;
+
+    crc = crc16_ccitt(CRC16_CCITT_INIT, log_buf, 3);
+
+    return crc16_ccitt(crc, &log_buf[LOG_HDR_SIZE], log_buf[2] * LOG_REC_SIZE);
+}
+
+/**
+ * @brief 获取已写满的保留块数（不含最新块）
+ * @param None
+ * @return 块数
+ */
+static uint16_t LOG_FullBlocks(void)
+{
+    return log_wrapped ? (EEPROM_LOG_BLOCK_NUM - 1) : log_head;
+}
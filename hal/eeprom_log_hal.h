@@ -0,0 +1,98 @@
+/**
+ * @file    eeprom_log_hal.h
+ * @brief   EEPROM 循环日志（定长记录）HAL 接口
+ * @author  ForeverMySunyu
+ * @version 1.0.0
+ * @date    2026-10-18
+ *
+ * @details
+ *  - 追加的记录先放在 xdata 块缓冲区中，攒满 1 块后写入 EEPROM（页大小 >= 32 时 1 块 = 1 页，只需 1 次页写入）
+ *  - 每块带 16 位序号，上电时 EEPROM_Log_Mount() 对块序号二分查找定位最新块，只读取 O(log n) 个块
+ *  - 记录编号从最旧的保留记录开始计数（0 为最旧），按编号读取 O(1)；
+ *    按时间戳查找时对记录编号二分查找，只读取 O(log n) 个时间戳
+ *  - 日志区写满后覆盖最旧的块（每次丢弃 1 块记录）
+ *
+ * @attention 时间戳必须单调不减（例如 RTC 秒数或 soft_timer_ticks() 的累计值），否则按时间戳查找的结果无意义
+ * @attention 缓冲区中尚未写入的记录掉电丢失；需要时调用 EEPROM_Log_Flush() 把未满的块写入
+ *            （该块之后还会被再次写入，频繁调用会增加该块的擦写次数）
+ *
+ * @code{.c}
+ * EEPROM_Log_Mount();
+ * EEPROM_Log_Append(now, sample);                  // 采样时调用
+ * ...
+ * EEPROM_Log_SeekTime(start_time, &index);         // 上位机读取某时刻之后的记录
+ * for (; index < EEPROM_Log_Count(); index++)
+ * {
+ *     EEPROM_Log_Read(index, &timestamp, sample);
+ * }
+ * @endcode
+ */
+
+#ifndef _EEPROM_LOG_HAL_H_
+#define _EEPROM_LOG_HAL_H_
+
+#include "stdint.h"
+#include "stdbool.h"
+#include "eeprom_hal.h"
+
+/* ========================= API 函数声明区域 ========================= */
+
+/**
+ * @brief 挂载日志：二分查找最新块，恢复写入位置
+ * @param None
+ * @return EEPROM 驱动程序错误码
+ */
+EEPROM_Error_T EEPROM_Log_Mount(void);
+
+/**
+ * @brief 清空日志
+ * @param None
+ * @return EEPROM 驱动程序错误码
+ */
+EEPROM_Error_T EEPROM_Log_Clear(void);
+
+/**
+ * @brief 追加 1 条记录
+ * @note 块缓冲区满时写入 EEPROM，否则只写入 RAM
+ * @param timestamp 时间戳（单调不减）
+ * @param dat 1 个指针，指向：EEPROM_LOG_DATA_SIZE 字节的记录数据
+ * @return EEPROM 驱动程序错误码
+ */
+EEPROM_Error_T EEPROM_Log_Append(uint32_t timestamp, const uint8_t *dat);
+
+/**
+ * @brief 把块缓冲区中尚未写入的记录写入 EEPROM
+ * @param None
+ * @return EEPROM 驱动程序错误码
+ */
+EEPROM_Error_T EEPROM_Log_Flush(void);
+
+/**
+ * @brief 获取保留的记录条数（含块缓冲区中的记录）
+ * @param None
+ * @return 记录条数
+ */
+uint32_t EEPROM_Log_Count(void);
+
+/**
+ * @brief 按记录编号读取 1 条记录
+ * @param index 记录编号（0 为最旧的保留记录）
+ * @param timestamp 用于返回时间戳，可为 NULL
+ * @param dat 1 个指针，指向：存放记录数据的缓冲区（EEPROM_LOG_DATA_SIZE 字节），可为 NULL
+ * @return EEPROM 驱动程序错误码
+ * @retval EEPROM_OK - 读取成功
+ *         EEPROM_ERR_NOT_FOUND - 编号超出保留的记录范围
+ */
+EEPROM_Error_T EEPROM_Log_Read(uint32_t index, uint32_t *timestamp, uint8_t *dat);
+
+/**
+ * @brief 按时间戳查找：第一条时间戳 >= timestamp 的记录
+ * @param timestamp 时间戳
+ * @param index 用于返回记录编号
+ * @return EEPROM 驱动程序错误码
+ * @retval EEPROM_OK - 找到
+ *         EEPROM_ERR_NOT_FOUND - 全部记录的时间戳都小于 timestamp
+ */
+EEPROM_Error_T EEPROM_Log_SeekTime(uint32_t timestamp, uint32_t *index);
+
+#endif      /* _EEPROM_LOG_HAL_H_ */
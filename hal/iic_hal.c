@@ -1,330 +1,85 @@
 /**
  * @file    iic_hal.c
  * @brief   IIC 软件模拟 hal 实现
- * @version 1.0.2
+ * @version 1.2.0
  * @author  ForeverMySunyu
- * @date    2025-12-29
+ * @date    2026-10-18
+ *
+ * @details
+ *  - 按 iic_configuration.h 中的总线数量，逐条包含总线驱动模板 iic_hal_bus.h，
+ *    为每条总线生成一套独立的、引脚与时序固定的驱动函数
+ *  - 各总线的统计信息与退避状态保存在本文件的静态数组中，模板内以常量下标直接访问
  */
 
+#include <stddef.h>
 #include "../core/delay.h"
 #include "../config/iic_configuration.h"
 #include "../bsp/iic_bsp.h"
 #include "iic_hal.h"
 
-/*==================== API 函数定义区域 ====================*/
-
-/**
- * @brief IIC 初始化函数
- * @param None
- * @return IIC 状态
- */
-iic_states_t IIC_Init_hal(void)
-{
-    IIC_Init_bsp();
-
-    SCL_Set(1);
-    SDA_Set(1);
-    delay_10us(10*IIC_DELAY_10US);
-
-    /* 若总线异常，尝试1次恢复 */
-    if (IIC_Wait_Bus_Idle() != IIC_OK)
-    {
-        IIC_Bus_Recover();
-    }
-
-    /* 检测 IIC 总线是否空闲，并返回 IIC 状态码 */
-    return IIC_Wait_Bus_Idle();
-}
-
-/**
- * @brief 检测 IIC 总线是否空闲
- * @param None
- * @return IIC 状态
- */
-iic_states_t IIC_Wait_Bus_Idle(void)
-{
-    uint16_t timeout = 0;
-
-    /* 释放 SDA 与 SCL */
-    SDA_Set(1);
-    SCL_Set(1);
-
-    while (!SCL_Read() || !SDA_Read())
-    {
-        timeout ++;
-
-        if (timeout >= IIC_BUS_IDLE_TIMEOUT)
-        {
-            return IIC_ERR_BUSY;
-        }
-    }
-
-    return IIC_OK;
-}
-
-/**
- * @brief 重置 IIC 总线及从机设备
- * @note  通过发送 1 个起始信号， 9 个 SCL 脉冲， 1 个起始信号， 1 个停止信号，尝试重置 IIC 总线及从机设备
- * @param None
- * @return IIC 状态（IIC_OK）
- */
-iic_states_t IIC_Slave_Reset(void)
-{
-    uint8_t i;
-
-    /* 释放 SDA 与 SCL */
-    SDA_Set(1);
-    delay_10us(IIC_DELAY_10US);
-    SCL_Set(1);
-    delay_10us(IIC_DELAY_10US);
-
-    /* 产生 START 信号 */
-    SDA_Set(0);
-    delay_10us(IIC_DELAY_10US);
-    SCL_Set(0);
-    delay_10us(IIC_DELAY_10US);
-
-    SDA_Set(1);
-    delay_10us(IIC_DELAY_10US);
-
-    /* 连续发送 9 个 SCL 脉冲 */
-    for (i = 0; i < 9; i++)
-    {
-        SCL_Set(1);
-        delay_10us(IIC_DELAY_10US);
-        SCL_Set(0);
-        delay_10us(IIC_DELAY_10US);
-    }
-
-    /* 产生 START 信号 */
-    SCL_Set(1);
-    delay_10us(IIC_DELAY_10US);
-    SDA_Set(0);
-    delay_10us(IIC_DELAY_10US);
-
-    SCL_Set(0);
-    delay_10us(IIC_DELAY_10US);
-    
-    /* 产生 STOP 信号 */
-    SCL_Set(1);
-    delay_10us(IIC_DELAY_10US);
-    SDA_Set(1);
-    delay_10us(IIC_DELAY_10US);
-
-    return IIC_OK;
-}
-
-/**
- * @brief 释放（恢复） IIC 总线
- * @note  通过发送 9 个 SCL 脉冲，尝试释放被从机拉低的 SDA
- * @param None
- * @return IIC 状态（IIC_OK）
- */
-iic_states_t IIC_Bus_Recover(void)
-{
-    uint8_t i;
-
-    /* 保证 SCL 为低，释放 SDA */
-    SCL_Set(0);
-    delay_10us(IIC_DELAY_10US);
-    SDA_Set(1);
-    delay_10us(IIC_DELAY_10US);
-
-    /* 连续发送 9 个 SCL 脉冲 */
-    for (i = 0; i < 9; i++)
-    {
-        SCL_Set(1);
-        delay_10us(IIC_DELAY_10US);
-        SCL_Set(0);
-        delay_10us(IIC_DELAY_10US);
-    }
-    
-    /* 强制产生 STOP 信号 */
-    SDA_Set(0);
-    delay_10us(IIC_DELAY_10US);
-    SCL_Set(1);
-    delay_10us(IIC_DELAY_10US);
-    SDA_Set(1);
-    delay_10us(IIC_DELAY_10US);
-
-    return IIC_OK;
-}
-
-/**
- * @brief IIC 起始信号
- * @param None
- * @return IIC 状态
- */
-iic_states_t IIC_Start(void)
-{
-    if (IIC_Wait_Bus_Idle() != IIC_OK)
-    {
-        /* 若总线异常，尝试1次恢复 */
-        IIC_Bus_Recover();
+/*==================== 总线状态 ====================*/
 
-        /* 若总线还是异常，返回总线忙错误状态 */
-        if(IIC_Wait_Bus_Idle() != IIC_OK)       return IIC_Wait_Bus_Idle();
-    }      
-    
-    SDA_Set(1);
-    SCL_Set(1);
-    delay_10us(IIC_DELAY_10US);
-    SDA_Set(0);
-    delay_10us(IIC_DELAY_10US);
-    SCL_Set(0);
+static iic_stats_t iic_stats[IIC_BUS_NUM];          //! 各总线统计信息
+static uint8_t iic_backoff[IIC_BUS_NUM];            //! 各总线剩余退避次数（0 表示未处于退避状态）
 
-    return IIC_OK;
-}
+//! 统计计数器加 1（饱和于 0xFFFF）
+#define IIC_STAT_INC(counter)       do { if ((counter) != 0xFFFF) (counter) ++; } while (0)
 
-/**
- * @brief 产生 IIC 重复起始信号
- * @note 不释放总线，直接从 SCL=1, SDA=1 → SDA=0
- * @attention 使用该函数前提：使用该函数的主机已占有总线
- * @return IIC 状态（IIC_OK）
- */
-iic_states_t IIC_Restart()
-{
-    /* 确保 SDA 为高（释放） */
-    SDA_Set(1);
-    delay_10us(IIC_DELAY_10US);
-    
-    /* 拉高 SCL，保持总线控制权 */
-    SCL_Set(1);
-    delay_10us(IIC_DELAY_10US);
+/*==================== 总线驱动生成区域 ====================*/
 
-    /* SDA 下降沿，产生 Repeated START */
-    SDA_Set(0);
-    delay_10us(IIC_DELAY_10US);
+#if IIC_BUS_NUM > 0
+    #define IIC_BUS_ID      0
+    #include "iic_hal_bus.h"
+    #undef IIC_BUS_ID
+#endif
 
-    /* 拉低 SCL，进入数据阶段 */
-    SCL_Set(0);
-    delay_10us(IIC_DELAY_10US);
+#if IIC_BUS_NUM > 1
+    #define IIC_BUS_ID      1
+    #include "iic_hal_bus.h"
+    #undef IIC_BUS_ID
+#endif
 
-    return IIC_OK;
-}
+#if IIC_BUS_NUM > 2
+    #define IIC_BUS_ID      2
+    #include "iic_hal_bus.h"
+    #undef IIC_BUS_ID
+#endif
 
-/**
- * @brief IIC 停止信号
- * @param None
- * @return IIC 状态（IIC_OK）
- */
-iic_states_t IIC_Stop(void)
-{
-    SDA_Set(0);
-    SCL_Set(1);
-    delay_10us(IIC_DELAY_10US);
-    SDA_Set(1);
-    delay_10us(IIC_DELAY_10US);
-
-    return IIC_OK;
-}
-
-/**
- * @brief 等待从机 ACK
- * @param None
- * @return IIC 状态
- * @retval IIC_OK - 收到从机 ACK
- *         IIC_ERR_NACK - 未收到从机 ACK
- */
-iic_states_t IIC_Wait_ACK(void)
-{
-    uint16_t timeout = 0;
+#if IIC_BUS_NUM > 3
+    #define IIC_BUS_ID      3
+    #include "iic_hal_bus.h"
+    #undef IIC_BUS_ID
+#endif
 
-    SDA_Set(1);     //! 释放 SDA 线
-    delay_10us(IIC_DELAY_10US);
-
-    SCL_Set(1);
-
-    while (SDA_Read())
-    {
-        timeout ++;
-
-        if(timeout >= IIC_ACK_TIMEOUT)
-        {
-            SCL_Set(0);
-            return IIC_ERR_NACK;
-        }
-    }
-    
-    SCL_Set(0);
-
-    return IIC_OK;
-}
-
-/**
- * @brief 发送 ACK 或 NACK
- * @param ack 0-发送 NACK，1-发送 ACK
- * @return IIC 状态（IIC_OK）
- */
-iic_states_t IIC_Send_ACK(bool ack)
-{
-    SDA_Set(!ack);
-    delay_10us(IIC_DELAY_10US);
-
-    SCL_Set(1);
-    delay_10us(IIC_DELAY_10US);
-    SCL_Set(0);
-
-    return IIC_OK;
-}
+/*==================== API 函数定义区域 ====================*/
 
 /**
- * @brief IIC 发送一个字节
- * @note 包含等待从机 ACK 程序
- * @param sendbyte 要发送的一个字节的数据
- * @return 是否接收到从机的 ACK
+ * @brief 获取总线统计信息
+ * @param bus 总线号（0 ~ IIC_BUS_NUM-1）
+ * @return 指向该总线统计信息的指针，总线号无效时返回 NULL
  */
-iic_states_t IIC_SendByte(unsigned char sendbyte)
+iic_stats_t *IIC_Get_Stats(uint8_t bus)
 {
-    uint8_t i;
-
-    /* 发送1个字节 */
-    for (i = 0; i < 8; i++)
-    {
-        SDA_Set(sendbyte & 0x80);
-        sendbyte <<= 1;
+    if (bus >= IIC_BUS_NUM)     return NULL;
 
-        SCL_Set(1);
-        delay_10us(IIC_DELAY_10US);
-        SCL_Set(0);
-        delay_10us(IIC_DELAY_10US);
-    }
-
-    /* 等待、检测从机 ACK，并返回对应状态码 */
-    return IIC_Wait_ACK();
+    return &iic_stats[bus];
 }
 
 /**
- * @brief IIC 接收一个字节
- * @note 包含发送 ACK 程序
- * @param receivebyte 用于保存接受到的1个字节的变量的地址
- * @param ack 是否发送 ACK（0=NACK，1=ACK）
- * @return IIC 状态（IIC_OK）
+ * @brief 清零总线统计信息，并结束该总线的退避状态
+ * @param bus 总线号（0 ~ IIC_BUS_NUM-1）
+ * @return None
  */
-iic_states_t IIC_ReceiveByte(unsigned char *receivebyte, bool ack)
+void IIC_Clear_Stats(uint8_t bus)
 {
-    uint8_t i;
-
-    *receivebyte = 0;
-
-    SDA_Set(1);     //! 释放 SDA 线
-
-    /* 读取1个字节 */
-    for (i = 0; i < 8; i++)
-    {
-        SCL_Set(1);
-        delay_10us(IIC_DELAY_10US);
+    if (bus >= IIC_BUS_NUM)     return;
 
-        *receivebyte <<= 1;
-        if (SDA_Read())
-        {
-            *receivebyte |= 0x01;
-        }
+    iic_stats[bus].nack = 0;
+    iic_stats[bus].bus_busy = 0;
+    iic_stats[bus].recover = 0;
+    iic_stats[bus].slave_reset = 0;
+    iic_stats[bus].backoff = 0;
+    iic_stats[bus].backoff_skip = 0;
 
-        SCL_Set(0);
-        delay_10us(IIC_DELAY_10US);
-    }
-    
-    /* 发送 ACK / NACK，并返回状态码 */
-    return IIC_Send_ACK(ack);
+    iic_backoff[bus] = 0;
 }
\ No newline at end of file
@@ -1,15 +1,25 @@
 /**
  * @file    iic_hal.h
  * @brief   IIC 软件模拟 hal 接口
- * @version 1.0.3
+ * @version 1.2.0
  * @author  ForeverMySunyu
- * @date    2025-12-31
+ * @date    2026-10-18
+ *
+ * @details
+ *  - 每条总线拥有一套独立的 API：IICn_Init_hal()、IICn_Start()、IICn_SendByte() ...（n 为总线号）
+ *  - 函数说明见 iic_hal_bus.h（总线驱动模板）
+ *  - 不带总线号的旧接口（IIC_Start() 等）映射到总线 0，兼容原有代码
+ *  - 上层模块可通过 IIC_BUS_API(总线号宏, 函数名) 在编译期选择所用总线，
+ *    例如 IIC_BUS_API(EEPROM_IIC_BUS, Start)()
+ *  - 超时按微秒配置，总线忙时按 “释放总线 → 复位从机 → 退避” 逐级处理，并按总线统计故障次数
  */
 
 #ifndef _IIC_HAL_H_
 #define _IIC_HAL_H_
 
+#include <stdint.h>
 #include <stdbool.h>
+#include "../config/iic_configuration.h"
 
 /*==================== IIC 返回状态码（可按需扩展） ====================*/
 
@@ -22,91 +32,88 @@ typedef enum
     IIC_ERR_BUSY    //! IIC 总线忙
 } iic_states_t;
 
-
-
-/*==================== API 函数声明区域 ====================*/
+/*==================== IIC 总线统计信息 ====================*/
 
 /**
- * @brief IIC 初始化函数
- * @param None
- * @return IIC 状态
+ * @brief 每条总线一份的故障统计计数器（到 0xFFFF 后不再增加）
+ * @note  最坏耗时可由计数值估算：
+ *        NACK 次数 × IIC_ACK_TIMEOUT_US + 总线忙次数 × IIC_BUS_IDLE_TIMEOUT_US + 恢复/复位次数 × 单次时序长度
+ *        EEPROM ACK 轮询期间器件忙产生的 NACK 同样计入 nack
  */
-iic_states_t IIC_Init_hal(void);
-
-/**
- * @brief 检测 IIC 总线是否空闲
- * @param None
- * @return IIC 状态
- */
-iic_states_t IIC_Wait_Bus_Idle(void);
-
-/**
- * @brief 重置 IIC 总线及从机设备
- * @note  通过发送 1 个起始信号， 9 个 SCL 脉冲， 1 个起始信号， 1 个停止信号，尝试重置 IIC 总线及从机设备
- * @param None
- * @return IIC 状态（IIC_OK）
- */
-iic_states_t IIC_Slave_Reset(void);
-
-/**
- * @brief 释放（恢复） IIC 总线
- * @note  通过发送 9 个 SCL 脉冲，尝试释放被从机拉低的 SDA
- * @param None
- * @return IIC 状态（IIC_OK）
- */
-iic_states_t IIC_Bus_Recovery(void);
-
-/**
- * @brief IIC 起始信号
- * @param None
- * @return IIC 状态
- */
-iic_states_t IIC_Start(void);
+typedef struct
+{
+    uint16_t nack;          //! 从机无应答次数
+    uint16_t bus_busy;      //! IIC_Start() 时发现总线忙的次数
+    uint16_t recover;       //! 执行 IIC_Bus_Recover() 的次数
+    uint16_t slave_reset;   //! 执行 IIC_Slave_Reset() 的次数
+    uint16_t backoff;       //! 恢复失败、进入退避的次数
+    uint16_t backoff_skip;  //! 退避期间被直接拒绝的 IIC_Start() 次数
+} iic_stats_t;
 
-/**
- * @brief 产生 IIC 重复起始信号
- * @note 不释放总线，直接从 SCL=1, SDA=1 → SDA=0
- * @attention 使用该函数前提：使用该函数的主机已占有总线
- * @return IIC 状态（IIC_OK）
- */
-iic_states_t IIC_Restart(void);
+/*==================== 总线 API 名称拼接 ====================*/
 
-/**
- * @brief IIC 停止信号
- * @param None
- * @return IIC 状态（IIC_OK）
- */
-iic_states_t IIC_Stop(void);
+//! 由总线号和函数名拼接出该总线的 API 名，例如 IIC_BUS_API(1, Start) -> IIC1_Start
+#define IIC_BUS_API(bus, name)      IIC_BUS_API_(bus, name)
+#define IIC_BUS_API_(bus, name)     IIC##bus##_##name
 
-/**
- * @brief 等待从机 ACK
- * @param None
- * @return IIC 状态
- */
-iic_states_t IIC_Wait_ACK(void);
+/*==================== API 函数声明区域 ====================*/
 
-/**
- * @brief 发送 ACK 或 NACK
- * @param ack 0-发送 NACK，1-发送 ACK
- * @return IIC 状态（IIC_OK）
- */
-iic_states_t IIC_Send_ACK(bool ack);
+//! 声明一条总线的全部 API
+#define IIC_HAL_DECLARE_BUS(bus)                                                    \
+    iic_states_t IIC_BUS_API(bus, Init_hal)(void);                                  \
+    iic_states_t IIC_BUS_API(bus, Wait_Bus_Idle)(void);                             \
+    iic_states_t IIC_BUS_API(bus, Slave_Reset)(void);                               \
+    iic_states_t IIC_BUS_API(bus, Bus_Recover)(void);                               \
+    iic_states_t IIC_BUS_API(bus, Start)(void);                                     \
+    iic_states_t IIC_BUS_API(bus, Restart)(void);                                   \
+    iic_states_t IIC_BUS_API(bus, Stop)(void);                                      \
+    iic_states_t IIC_BUS_API(bus, Wait_ACK)(void);                                  \
+    iic_states_t IIC_BUS_API(bus, Send_ACK)(bool ack);                              \
+    iic_states_t IIC_BUS_API(bus, SendByte)(unsigned char sendbyte);                \
+    iic_states_t IIC_BUS_API(bus, ReceiveByte)(unsigned char *receivebyte, bool ack);
+
+#if IIC_BUS_NUM > 0
+    IIC_HAL_DECLARE_BUS(0)
+#endif
+
+#if IIC_BUS_NUM > 1
+    IIC_HAL_DECLARE_BUS(1)
+#endif
+
+#if IIC_BUS_NUM > 2
+    IIC_HAL_DECLARE_BUS(2)
+#endif
+
+#if IIC_BUS_NUM > 3
+    IIC_HAL_DECLARE_BUS(3)
+#endif
 
 /**
- * @brief IIC 发送一个字节
- * @note 包含等待从机 ACK 程序
- * @param sendbyte 要发送的一个字节的数据
- * @return 是否接收到从机的 ACK
+ * @brief 获取总线统计信息
+ * @param bus 总线号（0 ~ IIC_BUS_NUM-1）
+ * @return 指向该总线统计信息的指针，总线号无效时返回 NULL
  */
-iic_states_t IIC_SendByte(unsigned char sendbyte);
+iic_stats_t *IIC_Get_Stats(uint8_t bus);
 
 /**
- * @brief IIC 接收一个字节
- * @note 包含发送 ACK 程序
- * @param receivebyte 用于保存接受到的1个字节的变量的地址
- * @param ack 是否发送 ACK（0=NACK，1=ACK）
- * @return IIC 状态（IIC_OK）
+ * @brief 清零总线统计信息，并结束该总线的退避状态
+ * @param bus 总线号（0 ~ IIC_BUS_NUM-1）
+ * @return None
  */
-iic_states_t IIC_ReceiveByte(unsigned char *receivebyte, bool ack);
+void IIC_Clear_Stats(uint8_t bus);
+
+/*==================== 旧接口（映射到总线 0） ====================*/
+
+#define IIC_Init_hal        IIC0_Init_hal
+#define IIC_Wait_Bus_Idle   IIC0_Wait_Bus_Idle
+#define IIC_Slave_Reset     IIC0_Slave_Reset
+#define IIC_Bus_Recover     IIC0_Bus_Recover
+#define IIC_Start           IIC0_Start
+#define IIC_Restart         IIC0_Restart
+#define IIC_Stop            IIC0_Stop
+#define IIC_Wait_ACK        IIC0_Wait_ACK
+#define IIC_Send_ACK        IIC0_Send_ACK
+#define IIC_SendByte        IIC0_SendByte
+#define IIC_ReceiveByte     IIC0_ReceiveByte
 
 #endif      /* _IIC_HAL_H_ */
\ No newline at end of file
@@ -0,0 +1,386 @@
+/**
+ * @file    iic_hal_bus.h
+ * @brief   IIC 软件模拟 hal 单总线驱动模板
+ * @version 1.3.0
+ * @author  ForeverMySunyu
+ * @date    2026-10-18
+ *
+ * @details
+ *  - 本文件没有头文件保护，只能由 iic_hal.c 在定义 IIC_BUS_ID 后包含，每包含一次生成一条总线的驱动
+ *  - 生成的函数名为 IIC<IIC_BUS_ID>_xxx，引脚与时序延时取自 iic_configuration.h 中对应总线的配置
+ *  - 引脚为编译期常量，时序延时为 0 的总线不会生成任何延时调用，不支持时钟延展的总线不会回读 SCL
+ *  - 统计信息与退避状态使用 iic_hal.c 中的 iic_stats[] / iic_backoff[]，下标为常量 IIC_BUS_ID
+ *
+ * @attention 不要在其他文件中包含本文件
+ */
+
+#ifndef IIC_BUS_ID
+#error "iic_hal_bus.h must be included by iic_hal.c with IIC_BUS_ID defined"
+#endif
+
+/*==================== 本总线专用宏 ====================*/
+
+#define IIC_FN(name)        IIC_BUS_API(IIC_BUS_ID, name)       //! 本总线 API 名
+
+#if IIC_BUS_API(IIC_BUS_ID, DELAY_10US)
+    #define IIC_DELAY()     delay_10us(IIC_BUS_API(IIC_BUS_ID, DELAY_10US))
+#else
+    #define IIC_DELAY()
+#endif
+
+//! 释放 SCL（支持时钟延展的总线会等待从机释放 SCL，最长 IIC_STRETCH_TIMEOUT_US）
+#if IIC_BUS_API(IIC_BUS_ID, CLOCK_STRETCH)
+    #define IIC_SCL_HIGH()                                                  \
+        do                                                                  \
+        {                                                                   \
+            uint16_t stretch_polls = IIC_STRETCH_TIMEOUT_POLLS;             \
+            SCL_Set(IIC_BUS_ID, 1);                                         \
+            while (!SCL_Read(IIC_BUS_ID) && --stretch_polls);               \
+        } while (0)
+#else
+    #define IIC_SCL_HIGH()  SCL_Set(IIC_BUS_ID, 1)
+#endif
+
+/*==================== API 函数定义区域 ====================*/
+
+/**
+ * @brief IIC 初始化函数
+ * @param None
+ * @return IIC 状态
+ */
+iic_states_t IIC_FN(Init_hal)(void)
+{
+    SCL_Set(IIC_BUS_ID, 1);
+    SDA_Set(IIC_BUS_ID, 1);
+    delay_10us(10);
+
+    /* 若总线异常，尝试1次恢复 */
+    if (IIC_FN(Wait_Bus_Idle)() != IIC_OK)
+    {
+        IIC_FN(Bus_Recover)();
+    }
+
+    /* 检测 IIC 总线是否空闲，并返回 IIC 状态码 */
+    return IIC_FN(Wait_Bus_Idle)();
+}
+
+/**
+ * @brief 检测 IIC 总线是否空闲
+ * @note 最长等待 IIC_BUS_IDLE_TIMEOUT_US 微秒
+ * @param None
+ * @return IIC 状态
+ */
+iic_states_t IIC_FN(Wait_Bus_Idle)(void)
+{
+    uint16_t polls = IIC_BUS_IDLE_TIMEOUT_POLLS;
+
+    /* 释放 SDA 与 SCL */
+    SDA_Set(IIC_BUS_ID, 1);
+    SCL_Set(IIC_BUS_ID, 1);
+
+    /* 等待 SCL、SDA 均被释放为高电平，或超时 */
+    while ((!SCL_Read(IIC_BUS_ID) || !SDA_Read(IIC_BUS_ID)) && --polls);
+
+    return (polls) ? IIC_OK : IIC_ERR_BUSY;
+}
+
+/**
+ * @brief 重置 IIC 总线及从机设备
+ * @note  通过发送 1 个起始信号， 9 个 SCL 脉冲， 1 个起始信号， 1 个停止信号，尝试重置 IIC 总线及从机设备
+ * @param None
+ * @return IIC 状态（IIC_OK）
+ */
+iic_states_t IIC_FN(Slave_Reset)(void)
+{
+    uint8_t i;
+
+    /* 释放 SDA 与 SCL */
+    SDA_Set(IIC_BUS_ID, 1);
+    IIC_DELAY();
+    SCL_Set(IIC_BUS_ID, 1);
+    IIC_DELAY();
+
+    /* 产生 START 信号 */
+    SDA_Set(IIC_BUS_ID, 0);
+    IIC_DELAY();
+    SCL_Set(IIC_BUS_ID, 0);
+    IIC_DELAY();
+
+    SDA_Set(IIC_BUS_ID, 1);
+    IIC_DELAY();
+
+    /* 连续发送 9 个 SCL 脉冲 */
+    for (i = 0; i < 9; i++)
+    {
+        SCL_Set(IIC_BUS_ID, 1);
+        IIC_DELAY();
+        SCL_Set(IIC_BUS_ID, 0);
+        IIC_DELAY();
+    }
+
+    /* 产生 START 信号 */
+    SCL_Set(IIC_BUS_ID, 1);
+    IIC_DELAY();
+    SDA_Set(IIC_BUS_ID, 0);
+    IIC_DELAY();
+
+    SCL_Set(IIC_BUS_ID, 0);
+    IIC_DELAY();
+
+    /* 产生 STOP 信号 */
+    SCL_Set(IIC_BUS_ID, 1);
+    IIC_DELAY();
+    SDA_Set(IIC_BUS_ID, 1);
+    IIC_DELAY();
+
+    return IIC_OK;
+}
+
+/**
+ * @brief 释放（恢复） IIC 总线
+ * @note  通过发送 9 个 SCL 脉冲，尝试释放被从机拉低的 SDA
+ * @param None
+ * @return IIC 状态（IIC_OK）
+ */
+iic_states_t IIC_FN(Bus_Recover)(void)
+{
+    uint8_t i;
+
+    /* 保证 SCL 为低，释放 SDA */
+    SCL_Set(IIC_BUS_ID, 0);
+    IIC_DELAY();
+    SDA_Set(IIC_BUS_ID, 1);
+    IIC_DELAY();
+
+    /* 连续发送 9 个 SCL 脉冲 */
+    for (i = 0; i < 9; i++)
+    {
+        SCL_Set(IIC_BUS_ID, 1);
+        IIC_DELAY();
+        SCL_Set(IIC_BUS_ID, 0);
+        IIC_DELAY();
+    }
+
+    /* 强制产生 STOP 信号 */
+    SDA_Set(IIC_BUS_ID, 0);
+    IIC_DELAY();
+    SCL_Set(IIC_BUS_ID, 1);
+    IIC_DELAY();
+    SDA_Set(IIC_BUS_ID, 1);
+    IIC_DELAY();
+
+    return IIC_OK;
+}
+
+/**
+ * @brief IIC 起始信号
+ * @note 总线忙时逐级处理：IIC_Bus_Recover() → IIC_Slave_Reset() → 退避，
+ *       退避期间的调用直接返回 IIC_ERR_BUSY，不访问总线
+ * @param None
+ * @return IIC 状态
+ * @retval IIC_OK - 已发出起始信号
+ *         IIC_ERR_BUSY - 总线忙（恢复失败或处于退避期间）
+ */
+iic_states_t IIC_FN(Start)(void)
+{
+    /* 退避期间直接返回，最坏耗时有界 */
+    if (iic_backoff[IIC_BUS_ID])
+    {
+        iic_backoff[IIC_BUS_ID] --;
+        IIC_STAT_INC(iic_stats[IIC_BUS_ID].backoff_skip);
+        return IIC_ERR_BUSY;
+    }
+
+    if (IIC_FN(Wait_Bus_Idle)() != IIC_OK)
+    {
+        IIC_STAT_INC(iic_stats[IIC_BUS_ID].bus_busy);
+
+        /* 第 1 级：释放总线 */
+        IIC_STAT_INC(iic_stats[IIC_BUS_ID].recover);
+        IIC_FN(Bus_Recover)();
+
+        if (IIC_FN(Wait_Bus_Idle)() != IIC_OK)
+        {
+            /* 第 2 级：复位从机 */
+            IIC_STAT_INC(iic_stats[IIC_BUS_ID].slave_reset);
+            IIC_FN(Slave_Reset)();
+
+            if (IIC_FN(Wait_Bus_Idle)() != IIC_OK)
+            {
+                /* 第 3 级：退避 */
+                IIC_STAT_INC(iic_stats[IIC_BUS_ID].backoff);
+                iic_backoff[IIC_BUS_ID] = IIC_BACKOFF_STARTS;
+
+                return IIC_ERR_BUSY;
+            }
+        }
+    }
+
+    SDA_Set(IIC_BUS_ID, 1);
+    SCL_Set(IIC_BUS_ID, 1);
+    IIC_DELAY();
+    SDA_Set(IIC_BUS_ID, 0);
+    IIC_DELAY();
+    SCL_Set(IIC_BUS_ID, 0);
+
+    return IIC_OK;
+}
+
+/**
+ * @brief 产生 IIC 重复起始信号
+ * @note 不释放总线，直接从 SCL=1, SDA=1 → SDA=0
+ * @attention 使用该函数前提：使用该函数的主机已占有总线
+ * @return IIC 状态（IIC_OK）
+ */
+iic_states_t IIC_FN(Restart)(void)
+{
+    /* 确保 SDA 为高（释放） */
+    SDA_Set(IIC_BUS_ID, 1);
+    IIC_DELAY();
+
+    /* 拉高 SCL，保持总线控制权 */
+    IIC_SCL_HIGH();
+    IIC_DELAY();
+
+    /* SDA 下降沿，产生 Repeated START */
+    SDA_Set(IIC_BUS_ID, 0);
+    IIC_DELAY();
+
+    /* 拉低 SCL，进入数据阶段 */
+    SCL_Set(IIC_BUS_ID, 0);
+    IIC_DELAY();
+
+    return IIC_OK;
+}
+
+/**
+ * @brief IIC 停止信号
+ * @param None
+ * @return IIC 状态（IIC_OK）
+ */
+iic_states_t IIC_FN(Stop)(void)
+{
+    SDA_Set(IIC_BUS_ID, 0);
+    IIC_SCL_HIGH();
+    IIC_DELAY();
+    SDA_Set(IIC_BUS_ID, 1);
+    IIC_DELAY();
+
+    return IIC_OK;
+}
+
+/**
+ * @brief 等待从机 ACK
+ * @note 最长等待 IIC_ACK_TIMEOUT_US 微秒
+ * @param None
+ * @return IIC 状态
+ * @retval IIC_OK - 收到从机 ACK
+ *         IIC_ERR_NACK - 未收到从机 ACK
+ */
+iic_states_t IIC_FN(Wait_ACK)(void)
+{
+    uint16_t polls = IIC_ACK_TIMEOUT_POLLS;
+
+    SDA_Set(IIC_BUS_ID, 1);     //! 释放 SDA 线
+    IIC_DELAY();
+
+    IIC_SCL_HIGH();
+
+    /* 等待从机拉低 SDA，或超时 */
+    while (SDA_Read(IIC_BUS_ID) && --polls);
+
+    SCL_Set(IIC_BUS_ID, 0);
+
+    if (!polls)
+    {
+        IIC_STAT_INC(iic_stats[IIC_BUS_ID].nack);
+        return IIC_ERR_NACK;
+    }
+
+    return IIC_OK;
+}
+
+/**
+ * @brief 发送 ACK 或 NACK
+ * @param ack 0-发送 NACK，1-发送 ACK
+ * @return IIC 状态（IIC_OK）
+ */
+iic_states_t IIC_FN(Send_ACK)(bool ack)
+{
+    SDA_Set(IIC_BUS_ID, !ack);
+    IIC_DELAY();
+
+    IIC_SCL_HIGH();
+    IIC_DELAY();
+    SCL_Set(IIC_BUS_ID, 0);
+
+    return IIC_OK;
+}
+
+/**
+ * @brief IIC 发送一个字节
+ * @note 包含等待从机 ACK 程序
+ * @param sendbyte 要发送的一个字节的数据
+ * @return 是否接收到从机的 ACK
+ */
+iic_states_t IIC_FN(SendByte)(unsigned char sendbyte)
+{
+    uint8_t i;
+
+    /* 发送1个字节 */
+    for (i = 0; i < 8; i++)
+    {
+        SDA_Set(IIC_BUS_ID, (sendbyte & 0x80) ? 1 : 0);
+        sendbyte <<= 1;
+
+        IIC_SCL_HIGH();
+        IIC_DELAY();
+        SCL_Set(IIC_BUS_ID, 0);
+        IIC_DELAY();
+    }
+
+    /* 等待、检测从机 ACK，并返回对应状态码 */
+    return IIC_FN(Wait_ACK)();
+}
+
+/**
+ * @brief IIC 接收一个字节
+ * @note 包含发送 ACK 程序
+ * @param receivebyte 用于保存接受到的1个字节的变量的地址
+ * @param ack 是否发送 ACK（0=NACK，1=ACK）
+ * @return IIC 状态（IIC_OK）
+ */
+iic_states_t IIC_FN(ReceiveByte)(unsigned char *receivebyte, bool ack)
+{
+    uint8_t i;
+    unsigned char receive = 0;      //! 在局部变量中移位，最后写回一次
+
+    SDA_Set(IIC_BUS_ID, 1);     //! 释放 SDA 线
+
+    /* 读取1个字节 */
+    for (i = 0; i < 8; i++)
+    {
+        IIC_SCL_HIGH();
+        IIC_DELAY();
+
+        receive <<= 1;
+        if (SDA_Read(IIC_BUS_ID))
+        {
+            receive |= 0x01;
+        }
+
+        SCL_Set(IIC_BUS_ID, 0);
+        IIC_DELAY();
+    }
+
+    *receivebyte = receive;
+
+    /* 发送 ACK / NACK，并返回状态码 */
+    return IIC_FN(Send_ACK)(ack);
+}
+
+/*==================== 清除本总线专用宏（允许再次包含） ====================*/
+
+#undef IIC_FN
+#undef IIC_DELAY
+#undef IIC_SCL_HIGH
\ No newline at end of file
@@ -0,0 +1,438 @@
+/**
+ * @file    onewire_hal.c
+ * @brief   1-Wire（单总线）软件模拟 hal 实现
+ * @version 1.0.0
+ * @author  ForeverMySunyu
+ * @date    2026-10-18
+ *
+ * @details
+ *  - ONEWIRE_DELAY_US(us) 在编译期换算为 DJNZ 循环次数，展开为 MOV Rn,#n + DJNZ，没有函数调用
+ *  - 每个时隙以 ONEWIRE_SLOT_BEGIN() / ONEWIRE_SLOT_END() 包围时序关键段，只在该段内关闭中断
+ *  - 复位脉冲低电平与恢复时间较长且允许被拉长，按 60us 为单位循环执行，期间不关中断
+ */
+
+#include <stddef.h>
+#include "../config/onewire_configuration.h"
+#include "../bsp/onewire_bsp.h"
+#include "onewire_hal.h"
+
+/*==================== 编译期时序换算 ====================*/
+
+//! 微秒换算为机器周期数（四舍五入）
+#define ONEWIRE_US_TO_CYCLES(us)    (((us) * (FOSC_HZ / MACHINE_CYCLE / 1000) + 500) / 1000)
+
+//! 微秒换算为 DJNZ 循环次数（每次 2 个机器周期，扣除固定开销，至少为 1）
+#define ONEWIRE_US_TO_LOOPS(us)     ((ONEWIRE_US_TO_CYCLES(us) > ONEWIRE_DELAY_OVERHEAD_CYCLES + 2) ?  \
+                                     ((ONEWIRE_US_TO_CYCLES(us) - ONEWIRE_DELAY_OVERHEAD_CYCLES) / 2) : 1)
+
+//! 内联精确延时（us 必须为编译期常量）
+#define ONEWIRE_DELAY_US(us)        { uint8_t data onewire_loops = ONEWIRE_US_TO_LOOPS(us); while (--onewire_loops); }
+
+#if (ONEWIRE_US_TO_LOOPS(60) > 255) || (ONEWIRE_US_TO_LOOPS(ONEWIRE_PRESENCE_WAIT_US) > 255) ||       \
+    (ONEWIRE_US_TO_LOOPS(ONEWIRE_WRITE0_LOW_US) > 255) || (ONEWIRE_US_TO_LOOPS(ONEWIRE_WRITE1_RECOVERY_US) > 255) || \
+    (ONEWIRE_US_TO_LOOPS(ONEWIRE_READ_RECOVERY_US) > 255)
+#error "1-Wire slot delay exceeds 255 DJNZ loops at this FOSC_HZ / MACHINE_CYCLE"
+#endif
+
+/*==================== 时隙中断控制 ====================*/
+
+//! 进入时序关键段：保存 EA 并关闭总中断
+#define ONEWIRE_SLOT_BEGIN()        { ea_save = EA; EA = 0; }
+//! 退出时序关键段：恢复 EA
+#define ONEWIRE_SLOT_END()          { EA = ea_save; }
+
+/*==================== ROM 搜索状态 ====================*/
+
+static uint8_t onewire_search_rom[ONEWIRE_ROM_SIZE];    //! 上一次搜索得到的 ROM 码
+static uint8_t onewire_last_discrepancy = 0;            //! 上一次搜索中最后一个选择 0 分支的冲突位（1~64，0 表示无）
+static bool onewire_last_device = 0;                    //! 上一次搜索已找到最后一个器件
+
+/*==================== 内部函数声明区域 ====================*/
+
+static onewire_states_t OneWire_Search(uint8_t *rom);
+
+/*==================== API 函数定义区域 ====================*/
+
+/**
+ * @brief 1-Wire 初始化函数
+ * @param None
+ * @return 1-Wire 状态
+ * @retval ONEWIRE_OK - 总线上有器件应答
+ *         ONEWIRE_ERR_NO_PRESENCE - 无器件应答
+ */
+onewire_states_t OneWire_Init_hal(void)
+{
+    OneWire_Init_bsp();
+
+    onewire_last_discrepancy = 0;
+    onewire_last_device = 0;
+
+    return OneWire_Reset();
+}
+
+/**
+ * @brief 复位脉冲 + 应答检测
+ * @note 中断只在 “释放总线 → 采样应答脉冲” 期间关闭
+ * @param None
+ * @return 1-Wire 状态
+ * @retval ONEWIRE_OK - 检测到应答脉冲
+ *         ONEWIRE_ERR_NO_PRESENCE - 无应答脉冲（或总线被短路到地）
+ */
+onewire_states_t OneWire_Reset(void)
+{
+    bit ea_save;
+    bit presence;
+    uint8_t i;
+
+    /* 复位脉冲：拉低 >= 480us（被中断拉长无影响） */
+    DQ_Set(0);
+    for (i = ONEWIRE_RESET_LOW_US / 60; i; i--)
+    {
+        ONEWIRE_DELAY_US(60);
+    }
+
+    /* 释放总线，在应答脉冲窗口内采样 */
+    ONEWIRE_SLOT_BEGIN();
+    DQ_Set(1);
+    ONEWIRE_DELAY_US(ONEWIRE_PRESENCE_WAIT_US);
+    presence = !DQ_Read();
+    ONEWIRE_SLOT_END();
+
+    /* 等待应答脉冲结束，复位时隙总长 >= 480us */
+    for (i = ONEWIRE_RESET_RECOVERY_US / 60; i; i--)
+    {
+        ONEWIRE_DELAY_US(60);
+    }
+
+    /* 应答脉冲结束后总线应恢复高电平，否则视为短路 */
+    if (!DQ_Read())     return ONEWIRE_ERR_NO_PRESENCE;
+
+    return presence ? ONEWIRE_OK : ONEWIRE_ERR_NO_PRESENCE;
+}
+
+/**
+ * @brief 写 1 位
+ * @note 中断只在拉低期间关闭
+ * @param bit_value 要写入的位
+ * @return None
+ */
+void OneWire_WriteBit(bool bit_value)
+{
+    bit ea_save;
+
+    if (bit_value)
+    {
+        ONEWIRE_SLOT_BEGIN();
+        DQ_Set(0);
+        ONEWIRE_DELAY_US(ONEWIRE_WRITE1_LOW_US);
+        DQ_Set(1);
+        ONEWIRE_SLOT_END();
+
+        ONEWIRE_DELAY_US(ONEWIRE_WRITE1_RECOVERY_US);
+    }
+    else
+    {
+        ONEWIRE_SLOT_BEGIN();
+        DQ_Set(0);
+        ONEWIRE_DELAY_US(ONEWIRE_WRITE0_LOW_US);
+        DQ_Set(1);
+        ONEWIRE_SLOT_END();
+
+        ONEWIRE_DELAY_US(ONEWIRE_WRITE0_RECOVERY_US);
+    }
+}
+
+/**
+ * @brief 读 1 位
+ * @note 中断只在 “拉低 → 采样” 期间关闭
+ * @param None
+ * @return 读到的位
+ */
+bool OneWire_ReadBit(void)
+{
+    bit ea_save;
+    bit bit_value;
+
+    ONEWIRE_SLOT_BEGIN();
+    DQ_Set(0);
+    ONEWIRE_DELAY_US(ONEWIRE_READ_LOW_US);
+    DQ_Set(1);
+    ONEWIRE_DELAY_US(ONEWIRE_READ_SAMPLE_US);
+    bit_value = DQ_Read();
+    ONEWIRE_SLOT_END();
+
+    ONEWIRE_DELAY_US(ONEWIRE_READ_RECOVERY_US);
+
+    return bit_value;
+}
+
+/**
+ * @brief 写 1 字节（低位先发送）
+ * @param byte 要写入的字节
+ * @return None
+ */
+void OneWire_WriteByte(uint8_t byte)
+{
+    uint8_t i;
+
+    for (i = 0; i < 8; i++)
+    {
+        OneWire_WriteBit(byte & 0x01);
+        byte >>= 1;
+    }
+}
+
+/**
+ * @brief 读 1 字节（低位先接收）
+ * @param None
+ * @return 读到的字节
+ */
+uint8_t OneWire_ReadByte(void)
+{
+    uint8_t i;
+    uint8_t byte = 0;
+
+    for (i = 0; i < 8; i++)
+    {
+        byte >>= 1;
+        if (OneWire_ReadBit())
+        {
+            byte |= 0x80;
+        }
+    }
+
+    return byte;
+}
+
+/**
+ * @brief 复位并选择器件
+ * @param rom 器件 ROM 码（8 字节），为 NULL 时发送 SKIP ROM 选择总线上全部器件
+ * @return 1-Wire 状态
+ */
+onewire_states_t OneWire_Select(const uint8_t *rom)
+{
+    uint8_t i;
+
+    if (OneWire_Reset() != ONEWIRE_OK)
+    {
+        return ONEWIRE_ERR_NO_PRESENCE;
+    }
+
+    if (rom == NULL)
+    {
+        OneWire_WriteByte(ONEWIRE_CMD_SKIP_ROM);
+    }
+    else
+    {
+        OneWire_WriteByte(ONEWIRE_CMD_MATCH_ROM);
+        for (i = 0; i < ONEWIRE_ROM_SIZE; i++)
+        {
+            OneWire_WriteByte(rom[i]);
+        }
+    }
+
+    return ONEWIRE_OK;
+}
+
+/**
+ * @brief 读取唯一器件的 ROM 码
+ * @attention 总线上只有 1 个器件时才能使用，多个器件时请使用 ROM 搜索
+ * @param rom 用于保存 ROM 码的缓冲区（8 字节）
+ * @return 1-Wire 状态
+ */
+onewire_states_t OneWire_ReadRom(uint8_t *rom)
+{
+    uint8_t i;
+
+    if (OneWire_Reset() != ONEWIRE_OK)
+    {
+        return ONEWIRE_ERR_NO_PRESENCE;
+    }
+
+    OneWire_WriteByte(ONEWIRE_CMD_READ_ROM);
+    for (i = 0; i < ONEWIRE_ROM_SIZE; i++)
+    {
+        rom[i] = OneWire_ReadByte();
+    }
+
+    return (OneWire_CRC8(rom, ONEWIRE_ROM_SIZE) == 0) ? ONEWIRE_OK : ONEWIRE_ERR_CRC;
+}
+
+/**
+ * @brief 开始 ROM 搜索
+ * @param rom 用于保存第 1 个器件 ROM 码的缓冲区（8 字节）
+ * @return 1-Wire 状态
+ * @retval ONEWIRE_OK - 找到器件
+ *         ONEWIRE_ERR_NO_PRESENCE - 总线上没有器件
+ *         ONEWIRE_ERR_CRC - ROM 码校验失败（可重新开始搜索）
+ */
+onewire_states_t OneWire_SearchFirst(uint8_t *rom)
+{
+    onewire_last_discrepancy = 0;
+    onewire_last_device = 0;
+
+    return OneWire_Search(rom);
+}
+
+/**
+ * @brief 继续 ROM 搜索
+ * @param rom 用于保存下一个器件 ROM 码的缓冲区（8 字节）
+ * @return 1-Wire 状态
+ * @retval ONEWIRE_OK - 找到器件
+ *         ONEWIRE_ERR_SEARCH_END - 已找到全部器件
+ *         ONEWIRE_ERR_NO_PRESENCE / ONEWIRE_ERR_CRC - 搜索失败
+ */
+onewire_states_t OneWire_SearchNext(uint8_t *rom)
+{
+    return OneWire_Search(rom);
+}
+
+/**
+ * @brief Dallas/Maxim CRC8（多项式 X^8+X^5+X^4+1，低位先计算）
+ * @note 对包含 CRC 字节在内的整个数据块计算，结果为 0 表示校验通过
+ * @param buf 指向数据
+ * @param length 字节数
+ * @return CRC8 值
+ */
+uint8_t OneWire_CRC8(const uint8_t *buf, uint8_t length)
+{
+    uint8_t crc = 0;
+    uint8_t i;
+    uint8_t byte;
+
+    while (length--)
+    {
+        byte = *buf++;
+
+        for (i = 0; i < 8; i++)
+        {
+            if ((crc ^ byte) & 0x01)
+            {
+                crc = (crc >> 1) ^ 0x8C;
+            }
+            else
+            {
+                crc >>= 1;
+            }
+            byte >>= 1;
+        }
+    }
+
+    return crc;
+}
+
+/*==================== 内部函数定义区域 ====================*/
+
+/**
+ * @brief ROM 搜索（Maxim 应用笔记 187 搜索算法）
+ * @note 每次调用沿上一次搜索的最后一个 0 分支冲突位转向 1 分支，找到下一个器件
+ * @param rom 用于保存 ROM 码的缓冲区（8 字节）
+ * @return 1-Wire 状态
+ */
+static onewire_states_t OneWire_Search(uint8_t *rom)
+{
+    uint8_t id_bit_number = 1;      //! 当前搜索的位序号（1~64）
+    uint8_t last_zero = 0;          //! 本次搜索中最后一个选择 0 分支的冲突位
+    uint8_t rom_byte_number = 0;
+    uint8_t rom_byte_mask = 0x01;
+    bool id_bit, cmp_id_bit, search_direction;
+    uint8_t i;
+
+    if (onewire_last_device)
+    {
+        onewire_last_discrepancy = 0;
+        onewire_last_device = 0;
+        return ONEWIRE_ERR_SEARCH_END;
+    }
+
+    if (OneWire_Reset() != ONEWIRE_OK)
+    {
+        onewire_last_discrepancy = 0;
+        return ONEWIRE_ERR_NO_PRESENCE;
+    }
+
+    OneWire_WriteByte(ONEWIRE_CMD_SEARCH_ROM);
+
+    do
+    {
+        /* 读取该位及其补码 */
+        id_bit = OneWire_ReadBit();
+        cmp_id_bit = OneWire_ReadBit();
+
+        /* 两者均为 1：没有器件参与搜索 */
+        if (id_bit && cmp_id_bit)
+        {
+            break;
+        }
+
+        if (id_bit != cmp_id_bit)
+        {
+            /* 所有器件该位相同 */
+            search_direction = id_bit;
+        }
+        else
+        {
+            /* 冲突：在上次冲突位之前沿用上次的选择，在上次冲突位处选 1，之后选 0 */
+            if (id_bit_number < onewire_last_discrepancy)
+            {
+                search_direction = (onewire_search_rom[rom_byte_number] & rom_byte_mask) ? 1 : 0;
+            }
+            else
+            {
+                search_direction = (id_bit_number == onewire_last_discrepancy);
+            }
+
+            if (!search_direction)
+            {
+                last_zero = id_bit_number;
+            }
+        }
+
+        if (search_direction)
+        {
+            onewire_search_rom[rom_byte_number] |= rom_byte_mask;
+        }
+        else
+        {
+            onewire_search_rom[rom_byte_number] &= ~rom_byte_mask;
+        }
+
+        /* 写入选择的方向，不匹配的器件退出本次搜索 */
+        OneWire_WriteBit(search_direction);
+
+        id_bit_number ++;
+        rom_byte_mask <<= 1;
+
+        if (!rom_byte_mask)
+        {
+            rom_byte_number ++;
+            rom_byte_mask = 0x01;
+        }
+    } while (rom_byte_number < ONEWIRE_ROM_SIZE);
+
+    /* 64 位未全部完成，搜索失败 */
+    if (id_bit_number < 65)
+    {
+        onewire_last_discrepancy = 0;
+        return ONEWIRE_ERR_NO_PRESENCE;
+    }
+
+    if (OneWire_CRC8(onewire_search_rom, ONEWIRE_ROM_SIZE) != 0)
+    {
+        onewire_last_discrepancy = 0;
+        return ONEWIRE_ERR_CRC;
+    }
+
+    onewire_last_discrepancy = last_zero;
+    if (!onewire_last_discrepancy)
+    {
+        onewire_last_device = 1;
+    }
+
+    for (i = 0; i < ONEWIRE_ROM_SIZE; i++)
+    {
+        rom[i] = onewire_search_rom[i];
+    }
+
+    return ONEWIRE_OK;
+}
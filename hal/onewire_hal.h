@@ -0,0 +1,58 @@
+/**
+ * @file    onewire_hal.h
+ * @brief   1-Wire（单总线）软件模拟 hal 接口
+ * @version 1.0.0
+ * @author  ForeverMySunyu
+ * @date    2026-10-18
+ *
+ * @details
+ *  - 时隙延时由 FOSC_HZ / MACHINE_CYCLE 在编译期换算为内联 DJNZ 循环，精度为 1 个机器周期
+ *  - 中断只在每个时隙的时序关键段内关闭（保存并恢复 EA），时隙之间与恢复期间允许中断，
+ *    整个事务（例如读 9 字节暂存器）期间中断延迟最大约为 1 个写 0 低电平时间（60us）
+ *  - 支持多器件：ROM 搜索（Maxim 搜索算法）、MATCH ROM / SKIP ROM 选择
+ */
+
+#ifndef _ONEWIRE_HAL_H_
+#define _ONEWIRE_HAL_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "../config/onewire_configuration.h"
+
+/*==================== 1-Wire 返回状态码（可按需扩展） ====================*/
+
+typedef enum
+{
+    ONEWIRE_OK = 0,             //! 操作成功
+
+    ONEWIRE_ERR = 1,            //! 未定义错误
+    ONEWIRE_ERR_NO_PRESENCE,    //! 复位后无器件应答
+    ONEWIRE_ERR_CRC,            //! CRC 校验失败
+    ONEWIRE_ERR_BUSY,           //! 器件忙（例如温度转换尚未完成）
+    ONEWIRE_ERR_SEARCH_END      //! ROM 搜索已结束，没有更多器件
+} onewire_states_t;
+
+/*==================== 1-Wire ROM 命令 ====================*/
+
+#define ONEWIRE_CMD_SEARCH_ROM      0xF0        //! 搜索 ROM
+#define ONEWIRE_CMD_READ_ROM        0x33        //! 读 ROM（总线上只有 1 个器件时使用）
+#define ONEWIRE_CMD_MATCH_ROM       0x55        //! 匹配 ROM
+#define ONEWIRE_CMD_SKIP_ROM        0xCC        //! 跳过 ROM
+
+#define ONEWIRE_ROM_SIZE            8           //! ROM 码长度（字节）：家族码 + 48 位序列号 + CRC8
+
+/*==================== API 函数声明区域 ====================*/
+
+onewire_states_t OneWire_Init_hal(void);                            //! 1-Wire 初始化，并检测总线上是否有器件
+onewire_states_t OneWire_Reset(void);                               //! 复位脉冲 + 应答检测
+void OneWire_WriteBit(bool bit_value);                              //! 写 1 位
+bool OneWire_ReadBit(void);                                         //! 读 1 位
+void OneWire_WriteByte(uint8_t byte);                               //! 写 1 字节（低位先发送）
+uint8_t OneWire_ReadByte(void);                                     //! 读 1 字节（低位先接收）
+onewire_states_t OneWire_Select(const uint8_t *rom);                //! 复位并选择器件（rom 为 NULL 时 SKIP ROM 选择全部器件）
+onewire_states_t OneWire_ReadRom(uint8_t *rom);                     //! 读取唯一器件的 ROM 码（含 CRC 校验）
+onewire_states_t OneWire_SearchFirst(uint8_t *rom);                 //! 开始 ROM 搜索，得到第 1 个器件的 ROM 码
+onewire_states_t OneWire_SearchNext(uint8_t *rom);                  //! 继续 ROM 搜索，得到下一个器件的 ROM 码
+uint8_t OneWire_CRC8(const uint8_t *buf, uint8_t length);           //! Dallas/Maxim CRC8（多项式 X^8+X^5+X^4+1）
+
+#endif  /* _ONEWIRE_HAL_H_ */
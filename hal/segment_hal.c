@@ -2,23 +2,163 @@
  * @file    segment_hal.C
  * @brief   数码管显示模块的 hal 驱动源文件
  * @details 本文件用于数码管显示模块的硬件抽象层驱动
- * @version 1.0.0
+ * @version 1.11.0
  * @author  ForeverMySunyu
- * @date    2025-12-22
+ * @date    2026-10-18
  */
 
 #include <stdbool.h>
 #include "../config/segment_configuration.h"
+#include "../config/timer_configuration.h"
+#include "../bsp/segment_bsp.h"
+#include "../core/timer.h"
 #include "segment_hal.h"
 
 
 
-/** 显示缓冲区 */
-static uint8_t seg_buffer[SEG_DIGIT_COUNT];
+#if (SEG_REFRESH_HZ < 50) || (SEG_REFRESH_HZ > 1000)
+    #error "SEG_REFRESH_HZ must be between 50 and 1000."
+#endif
+
+#if (SEG_BLANK_US > 50)
+    #error "SEG_BLANK_US must not exceed 50."
+#endif
+
+#if (SEG_BRIGHTNESS_BITS > 4)
+    #error "SEG_BRIGHTNESS_BITS must be between 0 and 4."
+#endif
+
+//! 亮度调制最短的一段（机器周期）需长于 1 次中断的耗时：现场保存与恢复、回调、重装约 100 个机器周期，加上每次刷新的耗时
+#if (SEG_BRIGHTNESS_BITS > 0)
+
+    #define SEG_SLICE_CYCLES        (SEG_SLOT_US * (FOSC_HZ / 1000) / 1000 / MACHINE_CYCLE / SEG_BRIGHTNESS_MAX)
+
+    #if (SEG_SLICE_CYCLES < (100 + SEG_REFRESH_CYCLES))
+        #error "The shortest brightness slice is shorter than one refresh interrupt, lower SEG_REFRESH_HZ or SEG_BRIGHTNESS_BITS."
+    #endif
+
+#endif
+
+#if (SEG_SCROLL_TEXT_MAX > 64)
+    #error "SEG_SCROLL_TEXT_MAX must not exceed 64."
+#endif
+
+//! 滚动显示每移动 1 位的帧数
+#define SEG_SCROLL_FRAMES       (SEG_SCROLL_MS * 1UL * SEG_REFRESH_HZ / 1000)
+
+#if (SEG_SCROLL_TEXT_MAX > 0) && ((SEG_SCROLL_FRAMES < 1) || (SEG_SCROLL_FRAMES > 255))
+    #error "SEG_SCROLL_MS * SEG_REFRESH_HZ / 1000 must be between 1 and 255."
+#endif
+
+//! 闪烁属性每个相位的帧数
+#define SEG_BLINK_FRAMES        (SEG_BLINK_MS * 1UL * SEG_REFRESH_HZ / 1000)
+
+#if (SEG_BLINK_MS > 0) && ((SEG_BLINK_FRAMES < 1) || (SEG_BLINK_FRAMES > 255))
+    #error "SEG_BLINK_MS * SEG_REFRESH_HZ / 1000 must be between 1 and 255."
+#endif
+
+//! 扫描时隙（亮度调制时为最短的一段）对应的 Timer0 计数值
+#if (SEG_BRIGHTNESS_BITS > 0)
+    #define SEG_SLICE_COUNT     (uint16_t)(FOSC_MHZ*SEG_SLOT_US/TIMER0_COUNT_RATE/SEG_BRIGHTNESS_MAX+0.5)
+#else
+    #define SEG_SLICE_COUNT     (uint16_t)(FOSC_MHZ*SEG_SLOT_US/TIMER0_COUNT_RATE+0.5)
+#endif
+
+
+//! seg_pending 的空值（idata 地址 0 为工作寄存器，不会是显示缓冲区）
+#define SEG_NO_PAGE             ((uint8_t idata *)0)
+
+//! 显示缓冲区页数：正在显示、等待切换、后台各 1 页，提交与写入都不需要等待帧边界
+#define SEG_PAGE_NUM            3
+
+
+/** 三页显示缓冲区（段码端口字节，[0] 为最低位）：中断显示前台页，segment_set_*() 写入后台页 */
+static uint8_t idata seg_page[SEG_PAGE_NUM][SEG_DIGIT_COUNT];
+
+/** 后台页：segment_set_*() 写入，segment_present() 后交给中断显示；不会是正在显示或等待切换的页 */
+static uint8_t idata * data seg_buffer = seg_page[0];
+
+/** 前台页：最近 1 次 segment_present() 提交的一页（正在显示或等待切换），后台页过期时从此复制 */
+static uint8_t idata * data seg_front = seg_page[1];
+
+/** 正在显示的窗口：中断显示 seg_window[0 ~ SEG_DIGIT_COUNT-1]，指向前台页或滚动缓冲区，只在帧边界切换 */
+static uint8_t idata * data seg_window = seg_page[1];
+
+/** 等待切换的窗口：前台写入，中断在帧边界赋给 seg_window 后清为 SEG_NO_PAGE（1 字节指针，读写均为原子操作） */
+static uint8_t idata * volatile seg_pending = SEG_NO_PAGE;
+
+/** 后台页内容已过期：提交后，第 1 次写入前从前台页复制 */
+static bool seg_back_stale = 0;
 
 /** 当前扫描位 */
 static uint8_t seg_scan_index = 0;
 
+/** 整屏区域：数值右对齐、字符串左对齐，高位填充全灭（segment_set_*() 使用） */
+static seg_region_t code seg_region_number_all = {0, SEG_DIGIT_COUNT, SEG_ALIGN_RIGHT, SEG_PAD_BLANK};
+static seg_region_t code seg_region_text_all = {0, SEG_DIGIT_COUNT, SEG_ALIGN_LEFT, SEG_PAD_BLANK};
+
+/** 10 的幂（seg_pow10[n] = 10^n），用于逐位减法转换 */
+static uint32_t code seg_pow10[10] = {1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000};
+static uint16_t code seg_pow10_16[4] = {1, 10, 100, 1000};
+
+#if (SEG_SCROLL_TEXT_MAX > 0)
+
+    /**
+     * 滚动缓冲区：[0, SEG_DIGIT_COUNT) 与 [SEG_SCROLL_TEXT_MAX + SEG_DIGIT_COUNT, 末尾) 为全灭的填充，
+     * 文本的第 1 个字符在 SEG_SCROLL_TEXT_MAX + SEG_DIGIT_COUNT - 1，之后的字符依次向低地址存放
+     */
+    static uint8_t idata seg_scroll_buffer[SEG_SCROLL_TEXT_MAX + 2 * SEG_DIGIT_COUNT];
+
+    static bool seg_scrolling = 0;                      //! 是否正在滚动
+    static uint8_t seg_scroll_count;                    //! 距下次移动的剩余帧数
+    static uint8_t idata * data seg_scroll_end;         //! 文本完全移出时的窗口位置
+
+#endif
+
+#if (SEG_BLINK_MS > 0)
+
+    static uint8_t seg_attr[SEG_DIGIT_COUNT];           //! 每位属性（SEG_ATTR_*）
+    static uint8_t seg_attr_phase = SEG_ATTR_NONE;      //! 当前相位生效的属性：点亮相位为 0，熄灭相位为全部闪烁属性
+    static uint8_t seg_blink_count = (uint8_t)SEG_BLINK_FRAMES;        //! 距下次切换相位的剩余帧数
+
+    //! 叠加属性：熄灭相位时闪烁的位全灭，小数点闪烁的位取反小数点
+    #define SEG_APPLY_ATTR(seg, index)      { uint8_t seg_attr_now = seg_attr[index] & seg_attr_phase; if (seg_attr_now & SEG_ATTR_BLINK) seg = SEG_BLANK_BYTE; else if (seg_attr_now) seg = SEG_CODE_DP_TOGGLE(seg); }
+
+#else
+
+    #define SEG_APPLY_ATTR(seg, index)      { }
+
+#endif
+
+#if (SEG_BRIGHTNESS_BITS > 0)
+
+    /** 每位亮度与全局亮度（0 ~ SEG_BRIGHTNESS_MAX） */
+    static uint8_t seg_digit_brightness[SEG_DIGIT_COUNT];
+    static uint8_t seg_global_brightness = SEG_BRIGHTNESS_MAX;
+
+    /** 每位实际亮度（每位亮度 × 全局亮度，由中断读取） */
+    static uint8_t seg_level[SEG_DIGIT_COUNT];
+
+    /** 当前分段：亮度位掩码与分段时长（计数值） */
+    static uint8_t seg_bcm_mask = 0x01;
+    static uint16_t seg_bcm_period = SEG_SLICE_COUNT;
+
+    /** 当前扫描位的段码（第 1 段取出并叠加属性，后续各段复用） */
+    static uint8_t seg_scan_code;
+
+#endif
+
+
+
+/* ================== 内部函数声明区域 ================== */
+static uint8_t idata *segment_region_begin(const seg_region_t *region);        //! 检查区域并准备写入，返回区域在后台页中的起始地址
+static void segment_put_decimal(const seg_region_t *region, uint32_t value, bool nagative_number, uint8_t decimal_places);     //! 把定点十进制数写入区域（不使用除法）
+static uint8_t segment_put_text(const char *str, uint8_t idata *buf, uint8_t size);     //! 把字符串编码为段码
+static void segment_wait_swap(void);        //! 等待中断完成窗口切换（只在开始滚动显示时使用）
+static uint8_t idata *segment_free_page(void);      //! 找出既不在显示也不在等待切换的一页
+static void segment_begin_write(void);      //! 准备写入后台页
+static void segment_frame_end(void);        //! 每帧结束时调用（切换窗口，滚动显示移动窗口）
+static uint16_t segment_scan(void);     //! 动态扫描刷新函数，刷新 1 位或 1 个亮度分段（在 Timer0 中断中调用）
 
 
 /* ================== API 函数定义区域 ================== */
@@ -30,90 +170,288 @@ static uint8_t seg_scan_index = 0;
  */
 void segment_init_hal(void)
 {
+    uint8_t i;
+
+    for(i=0;i<SEG_DIGIT_COUNT;i++)
+    {
+        seg_page[0][i] = SEG_BLANK_BYTE;
+        seg_page[1][i] = SEG_BLANK_BYTE;
+        seg_page[2][i] = SEG_BLANK_BYTE;
+
+        #if (SEG_BRIGHTNESS_BITS > 0)
+            seg_digit_brightness[i] = SEG_BRIGHTNESS_MAX;
+            seg_level[i] = SEG_BRIGHTNESS_MAX;
+        #endif
+    }
+
     segment_init_bsp();
 
-    clear_seg_buffer();
+    timer0_register_callback(segment_scan);     //! 将本层的函数 segment_scan(); 注册到Core层
+}
+
+/**
+ * @brief 提交后台页：在下一帧边界显示，之后的 segment_set_*() 写入另一页
+ * @details 只写入 1 字节指针，由 Timer0 中断在帧边界切换，不关闭中断，中断也不会显示写了一半的内容；
+ *          同时停止滚动显示
+ * @note 不等待帧边界：1 帧内多次提交时，尚未显示的上一次提交被替换（只显示最后 1 次），后台页总有空闲的一页
+ * @param None
+ * @return None
+ */
+void segment_present(void)
+{
+    #if (SEG_SCROLL_TEXT_MAX > 0)
+        seg_scrolling = 0;      //! 先停止滚动，中断不再移动窗口
+    #endif
+
+    seg_front = seg_buffer;
+    seg_pending = seg_buffer;           //! 此后中断只会切换到这一页，不会再切换到被替换的页
+    seg_buffer = segment_free_page();
+    seg_back_stale = 1;
 }
 
 /**
- * @brief 清空数码管显示缓冲区
+ * @brief 清空数码管显示缓冲区（后台页）
  * @param None
  * @return None
  */
 void clear_seg_buffer(void)
 {
-    uint8_t i;
+    segment_region_clear(&seg_region_text_all);
+}
 
-    for(i=0;i<SEG_DIGIT_COUNT;i++)      seg_buffer[i] = 21;
+/**
+ * @brief 设置要显示的**字符串**
+ * @details 从最高位开始左对齐显示，多余的字符不显示；'.' 合并到前一个字符的小数点上（如 "12.5" 只占 3 位）
+ * @note 可显示 ASCII 0x20 ~ 0x7e，七段无法表示的字符近似显示，其余字符显示为全灭
+ * @param str 要显示的字符串（如 "Err"、"SEt"、"HI"）
+ * @return None
+ */
+void segment_set_string(const char *str)
+{
+    segment_region_set_string(&seg_region_text_all, str);
 }
 
 /**
- * @brief 设置要显示的**整数**数值
- * @param value 要显示的整数数值
+ * @brief 循环滚动显示字符串（从右向左移动）
+ * @details 字符串只在调用时编码 1 次，之后每 SEG_SCROLL_MS 由 Timer0 中断在帧边界把显示窗口移动 1 位；
+ *          立即生效（不需要 segment_present()），调用 segment_present() 时停止滚动；
+ *          SEG_SCROLL_TEXT_MAX 为 0 时写入后台页并提交
+ * @param str 要滚动显示的字符串（超过 SEG_SCROLL_TEXT_MAX 个字符时截断）
  * @return None
  */
-void segment_set_int_number(int32_t value)
+void segment_scroll_string(const char *str)
 {
-    uint8_t i;
-    bool nagative_number = 0;
+    #if (SEG_SCROLL_TEXT_MAX > 0)
+        uint8_t i;
+        uint8_t n;
 
-    #if 0   //! 控制是否启用超出最大值检测
+        segment_wait_swap();
+        seg_scrolling = 0;
 
-        //! 如果要显示的十进制值超过8位数，则显示不下
-        if (value > 99999999)
+        //! 正在显示滚动缓冲区时先切换到前台页（最长等待 1 帧），重写期间中断不再访问滚动缓冲区
+        if (seg_window != seg_front)
         {
-            for(i=0;i<SEG_DIGIT_COUNT;i++)      seg_buffer[i] = 20;
+            seg_pending = seg_front;
+            segment_wait_swap();
         }
-        else if (value < -9999999)
+
+        for(i=0;i<sizeof(seg_scroll_buffer);i++)    seg_scroll_buffer[i] = SEG_BLANK_BYTE;
+
+        n = segment_put_text(str, seg_scroll_buffer + SEG_DIGIT_COUNT, SEG_SCROLL_TEXT_MAX);
+
+        //! 窗口从上方的填充开始（全灭），文本从最低位进入，向左移出后回到开始位置
+        seg_scroll_end = seg_scroll_buffer + SEG_SCROLL_TEXT_MAX - n;
+        seg_scroll_count = (uint8_t)SEG_SCROLL_FRAMES;
+        seg_pending = seg_scroll_buffer + SEG_SCROLL_TEXT_MAX + SEG_DIGIT_COUNT;
+        seg_scrolling = 1;          //! 在 seg_pending 之后置位：中断先切换窗口，下一次移动才会开始
+    #else
+        segment_set_string(str);
+        segment_present();
+    #endif
+}
+
+/**
+ * @brief 设置亮度
+ * @note 每位的实际亮度 = 每位亮度 × 全局亮度 / SEG_BRIGHTNESS_MAX；SEG_BRIGHTNESS_BITS 为 0 时无效（始终全亮）
+ * @param digit 位号（0 ~ SEG_DIGIT_COUNT-1，0 为最低位），SEG_DIGIT_ALL 为设置全局亮度
+ * @param level 亮度（0 ~ SEG_BRIGHTNESS_MAX，0 为熄灭，超出时按最大值处理）
+ * @return None
+ */
+void segment_set_brightness(uint8_t digit, uint8_t level)
+{
+    #if (SEG_BRIGHTNESS_BITS > 0)
+        uint8_t i;
+
+        if (level > SEG_BRIGHTNESS_MAX)     level = SEG_BRIGHTNESS_MAX;
+
+        if (digit == SEG_DIGIT_ALL)
+        {
+            seg_global_brightness = level;
+        }
+        else if (digit < SEG_DIGIT_COUNT)
         {
-            for(i=0;i<SEG_DIGIT_COUNT;i++)      seg_buffer[i] = 20;
+            seg_digit_brightness[digit] = level;
+        }
+        else
+        {
+            return;
         }
 
+        //! 乘法与除法在此处完成，中断中只做 1 次按位与
+        for(i=0;i<SEG_DIGIT_COUNT;i++)
+        {
+            seg_level[i] = (uint8_t)(((uint16_t)seg_digit_brightness[i] * seg_global_brightness + SEG_BRIGHTNESS_MAX / 2) / SEG_BRIGHTNESS_MAX);
+        }
     #endif
-    
-    //! 检查要显示的数字是否是负数
-    if(value < 0)
-    {
-        nagative_number = 1;
-        value = -value;
-    }
+}
 
-    //! 从低位到高位设置 seg_buffer 数组
-    for (i = 0; i < SEG_DIGIT_COUNT; i++)
-    {
-        if(value)
+/**
+ * @brief 设置每位属性
+ * @details 属性由 Timer0 中断在每位刷新时叠加，每 SEG_BLINK_MS 切换 1 次相位；
+ *          设置后从点亮相位重新开始计时（如编辑时按键修改数值后立即可见）
+ * @note 属性属于数码管位，立即生效，不随 segment_present() 交换；SEG_BLINK_MS 为 0 时无效
+ * @param digit 位号（0 ~ SEG_DIGIT_COUNT-1，0 为最低位），SEG_DIGIT_ALL 为设置所有位
+ * @param attr 属性（SEG_ATTR_BLINK、SEG_ATTR_FLASH_DP 按位或，SEG_ATTR_NONE 为正常显示）
+ * @return None
+ */
+void segment_set_attr(uint8_t digit, uint8_t attr)
+{
+    #if (SEG_BLINK_MS > 0)
+        uint8_t i;
+
+        if (digit == SEG_DIGIT_ALL)
         {
-            seg_buffer[i] = value % 10;
+            for(i=0;i<SEG_DIGIT_COUNT;i++)      seg_attr[i] = attr;
+        }
+        else if (digit < SEG_DIGIT_COUNT)
+        {
+            seg_attr[digit] = attr;
         }
         else
         {
-            //! 如果是负数且还未设置显示负号
-            if (nagative_number)
-            {
-                seg_buffer[i] = 20;         //! 显示负号
-                nagative_number = 0;
-            }
-            else
-            {
-                seg_buffer[i] = 21;         //! 设置全灭不显示
-            }
+            return;
         }
 
-        value /= 10;
+        //! 先切换到点亮相位再重置计数，中断在两步之间最多提前 1 帧切换
+        seg_attr_phase = SEG_ATTR_NONE;
+        seg_blink_count = (uint8_t)SEG_BLINK_FRAMES;
+    #endif
+}
+
+/**
+ * @brief 设置要显示的**整数**数值
+ * @note 超出显示范围时全部显示 '-'
+ * @param value 要显示的整数数值
+ * @return None
+ */
+void segment_set_int_number(int32_t value)
+{
+    segment_set_fixed_number(value, 0);
+}
+
+/**
+ * @brief 设置要显示的**定点数**数值
+ * @details 显示 value / 10^decimal_places，例如 segment_set_fixed_number(-1234, 2) 显示 "-12.34"
+ *  - 整数部分至少显示 1 位（0.05 显示为 "0.05"），其余高位的 0 不显示
+ *  - 位数不够时从最低位开始舍去小数位并四舍五入，整数部分也放不下时全部显示 '-'
+ * @param value 放大 10^decimal_places 倍后的整数
+ * @param decimal_places 小数位数（0~9）
+ * @return None
+ */
+void segment_set_fixed_number(int32_t value, uint8_t decimal_places)
+{
+    segment_region_set_fixed(&seg_region_number_all, value, decimal_places);
+}
+
+/**
+ * @brief 清空区域（全灭），区域外的位不变
+ * @param region 区域
+ * @return None
+ */
+void segment_region_clear(const seg_region_t *region)
+{
+    uint8_t idata *buf = segment_region_begin(region);
+    uint8_t i;
+
+    if (buf == SEG_NO_PAGE)     return;
+
+    for(i=0;i<region->width;i++)        buf[i] = SEG_BLANK_BYTE;
+}
+
+/**
+ * @brief 在区域中显示**整数**数值，区域外的位不变
+ * @note 超出区域宽度时区域内全部显示 '-'
+ * @param region 区域
+ * @param value 要显示的整数数值
+ * @return None
+ */
+void segment_region_set_int(const seg_region_t *region, int32_t value)
+{
+    segment_region_set_fixed(region, value, 0);
+}
+
+/**
+ * @brief 在区域中显示**定点数**数值，区域外的位不变
+ * @note 显示规则同 segment_set_fixed_number()，显示位数为区域宽度；按区域的对齐方式与填充方式放置
+ * @param region 区域
+ * @param value 放大 10^decimal_places 倍后的整数
+ * @param decimal_places 小数位数（0~9）
+ * @return None
+ */
+void segment_region_set_fixed(const seg_region_t *region, int32_t value, uint8_t decimal_places)
+{
+    if(value < 0)
+    {
+        segment_put_decimal(region, 0 - (uint32_t)value, 1, decimal_places);
+    }
+    else
+    {
+        segment_put_decimal(region, (uint32_t)value, 0, decimal_places);
     }
-    
 }
 
+/**
+ * @brief 在区域中显示**字符串**，区域外的位不变
+ * @note 编码规则同 segment_set_string()，超出区域宽度的字符不显示；按区域的对齐方式放置，其余位全灭
+ * @param region 区域
+ * @param str 要显示的字符串
+ * @return None
+ */
+void segment_region_set_string(const seg_region_t *region, const char *str)
+{
+    uint8_t idata *buf = segment_region_begin(region);
+    uint8_t size;
+    uint8_t n;
+    uint8_t i;
+
+    if (buf == SEG_NO_PAGE)     return;
+
+    size = region->width;
+    n = segment_put_text(str, buf, size);       //! 占用 buf[size-n] ~ buf[size-1]
+
+    if (region->align == SEG_ALIGN_RIGHT)
+    {
+        for (i = 0; i < n; i++)     buf[i] = buf[size - n + i];         //! 移到低位
+        for (; i < size; i++)       buf[i] = SEG_BLANK_BYTE;
+    }
+    else
+    {
+        for (i = 0; i < size - n; i++)      buf[i] = SEG_BLANK_BYTE;
+    }
+}
+
+#if SEG_FLOAT_SUPPORT
+
 /**
  * @brief 设置要显示的**浮点数**数值
+ * @note 转换为定点数后显示，规则同 segment_set_fixed_number()；会链接 C51 浮点运算库
  * @param value 要显示的浮点数数值
- * @param decimal_places 要显示的小数位数
+ * @param decimal_places 要显示的小数位数（0~9）
  * @return None
  */
 void segment_set_float_number(float value, uint8_t decimal_places)
 {
     uint8_t i;
-    uint32_t value_int;
     bool nagative_number = 0;
 
     //! 检查要显示的数字是否是负数
@@ -123,70 +461,405 @@ void segment_set_float_number(float value, uint8_t decimal_places)
         value = -value;
     }
 
-    //! 转化为整数
+    //! 转化为定点数
     for (i = 0; i < decimal_places; i++)
     {
         value *= 10;
     }
-    value_int = (uint32_t) value;
-    
-    #if 0   //! 控制是否启用超出最大值检测
 
-        //! 如果要显示的十进制值超过8位数，则显示不下
-        if (value > 99999999)
-        {
-            for(i=0;i<SEG_DIGIT_COUNT;i++)      seg_buffer[i] = 20;
-        }
-        else if ((nagative_number) && (value > 9999999))
-        {
-            for(i=0;i<SEG_DIGIT_COUNT;i++)      seg_buffer[i] = 20;
-        }
+    //! 超出 32 位时减少小数位数，避免转换溢出
+    while ((value >= 4000000000.0) && (decimal_places > 0))
+    {
+        value /= 10;
+        decimal_places --;
+    }
 
-    #endif
+    segment_put_decimal(&seg_region_number_all, (value < 4000000000.0) ? (uint32_t)(value + 0.5) : 0xffffffff, nagative_number, decimal_places);
+}
+
+#endif
+
+/**
+ * @brief 设置区域内各位的属性，区域外的位不变
+ * @note 规则同 segment_set_attr()
+ * @param region 区域（只使用 offset 与 width）
+ * @param attr 属性（SEG_ATTR_BLINK、SEG_ATTR_FLASH_DP 按位或，SEG_ATTR_NONE 为正常显示）
+ * @return None
+ */
+void segment_region_set_attr(const seg_region_t *region, uint8_t attr)
+{
+    uint8_t i;
+
+    if ((region->offset >= SEG_DIGIT_COUNT) || (region->width > SEG_DIGIT_COUNT - region->offset))
+    {
+        return;
+    }
 
-    //! 从低位到高位设置 seg_buffer 数组
-    for (i = 0; i < SEG_DIGIT_COUNT; i++)
+    for (i = region->offset; i < region->offset + region->width; i++)
     {
-        if(value_int)
+        segment_set_attr(i, attr);
+    }
+}
+
+/* ================== 内部函数定义区域 ================== */
+
+/**
+ * @brief 检查区域并准备写入后台页
+ * @param region 区域
+ * @return 区域最低位在后台页中的地址，区域无效（宽度为 0 或超出 SEG_DIGIT_COUNT）时返回 SEG_NO_PAGE
+ */
+static uint8_t idata *segment_region_begin(const seg_region_t *region)
+{
+    if ((region->width == 0) || (region->offset >= SEG_DIGIT_COUNT) || (region->width > SEG_DIGIT_COUNT - region->offset))
+    {
+        return SEG_NO_PAGE;
+    }
+
+    segment_begin_write();
+
+    return seg_buffer + region->offset;
+}
+
+/**
+ * @brief 把定点十进制数写入区域（不使用除法）
+ * @details 从最高位开始，每位用减去 10 的幂的次数得到该位数字（每位最多减 9 次）：
+ *          第 4 位及以上用 32 位运算（值小于 10000 时整段跳过），第 2~3 位用 16 位运算，十位用 8 位运算，
+ *          省去了每位 1 次 32 位除法和 1 次 32 位取余；舍去小数位时在数字数组上四舍五入
+ * @param region 区域（显示位数为区域宽度）
+ * @param value 要显示的数值（绝对值，放大 10^decimal_places 倍）
+ * @param nagative_number 是否为负数（在最高有效位左侧显示负号）
+ * @param decimal_places 小数位数（0~9）
+ * @return None
+ */
+static void segment_put_decimal(const seg_region_t *region, uint32_t value, bool nagative_number, uint8_t decimal_places)
+{
+    uint8_t idata *buf = segment_region_begin(region);
+    uint8_t size;               //! 区域宽度
+    uint8_t digits[10];         //! 各位数字，digits[0] 为个位
+    uint8_t i = 10;
+    uint8_t width;              //! 需要显示的位数（不含负号）
+    uint8_t drop;               //! 舍去的小数位数
+    uint8_t fill;               //! 数字以外的位的段码
+    uint16_t value16;
+    uint8_t value8;
+
+    if (buf == SEG_NO_PAGE)     return;
+
+    size = region->width;
+
+    //! 第 4 位及以上：32 位减法
+    if (value >= 10000)
+    {
+        while (i > 4)
         {
-            seg_buffer[i] = value_int % 10;
+            i--;
+            for (digits[i] = 0; value >= seg_pow10[i]; digits[i]++)     value -= seg_pow10[i];
         }
-        else
+    }
+    else
+    {
+        while (i > 4)       digits[--i] = 0;
+    }
+
+    //! 第 2~3 位：16 位减法
+    value16 = (uint16_t)value;
+    while (i > 2)
+    {
+        i--;
+        for (digits[i] = 0; value16 >= seg_pow10_16[i]; digits[i]++)    value16 -= seg_pow10_16[i];
+    }
+
+    //! 十位与个位：8 位减法
+    value8 = (uint8_t)value16;
+    for (digits[1] = 0; value8 >= 10; digits[1]++)      value8 -= 10;
+    digits[0] = value8;
+
+    //! 有效位数，整数部分至少 1 位
+    for (width = 10; (width > decimal_places + 1) && (digits[width - 1] == 0); width--);
+
+    //! 位数不够时舍去小数位，第 1 个舍去的数字不小于 5 时向上进位
+    drop = 0;
+    if (width + nagative_number > size)
+    {
+        drop = width + nagative_number - size;
+
+        if ((drop <= decimal_places) && (digits[drop - 1] >= 5))
         {
-            //! 如果是负数且还未设置显示负号
-            if (nagative_number)
+            for (i = drop; (i < width) && (digits[i] == 9); i++)    digits[i] = 0;
+
+            if (i < width)
             {
-                seg_buffer[i] = 20;         //! 显示负号
-                nagative_number = 0;
+                digits[i]++;
             }
             else
             {
-                seg_buffer[i] = 21;         //! 设置全灭不显示
+                digits[width] = 1;          //! 进位使位数增加（如 9.99 -> 10.0），再舍去 1 位（该位已为 0）
+                width++;
+                drop++;
+            }
+        }
+    }
+
+    //! 整数部分也放不下（或小数位数无效）
+    if ((drop > decimal_places) || (decimal_places > 9))
+    {
+        for(i=0;i<size;i++)     buf[i] = segment_code_table[SEG_CODE_MINUS];
+        return;
+    }
+
+    decimal_places -= drop;
+    width -= drop;
+
+    //! 舍入后为 0 时不显示负号
+    if (nagative_number)
+    {
+        for (i = 0; (i < width) && (digits[drop + i] == 0); i++);
+        if (i == width)     nagative_number = 0;
+    }
+
+    if (region->pad == SEG_PAD_ZERO)
+    {
+        fill = segment_code_table[0];       //! 补零：数字与负号之间填 '0'，负号在区域的最高位
+    }
+    else
+    {
+        fill = SEG_BLANK_BYTE;
+
+        //! 左对齐时低位全灭，内容移到区域的高位
+        if (region->align == SEG_ALIGN_LEFT)
+        {
+            while (size > width + nagative_number)
+            {
+                *buf++ = SEG_BLANK_BYTE;
+                size--;
             }
         }
+    }
 
-        value_int /= 10;
+    //! 写入显示缓冲区
+    for (i = 0; i < width; i++)
+    {
+        buf[i] = segment_code_table[digits[drop + i]];
+    }
+
+    for (; i < size; i++)
+    {
+        buf[i] = fill;
+    }
+
+    if (nagative_number)
+    {
+        buf[(region->pad == SEG_PAD_ZERO) ? (size - 1) : width] = segment_code_table[SEG_CODE_MINUS];      //! 显示负号
     }
 
     //! 显示小数点
-    seg_buffer[decimal_places] += 10;
+    if (decimal_places)
+    {
+        buf[decimal_places] = SEG_CODE_DP(buf[decimal_places]);
+    }
+}
+
+/**
+ * @brief 把字符串编码为段码，从 buf[size-1] 开始向低地址存放
+ * @note '.' 合并到前一个字符的小数点上，不占用位置
+ * @param str 字符串
+ * @param buf 存放段码的缓冲区
+ * @param size 缓冲区大小（最多编码的字符数）
+ * @return 编码的字符数
+ */
+static uint8_t segment_put_text(const char *str, uint8_t idata *buf, uint8_t size)
+{
+    uint8_t n = 0;
+    uint8_t c;
+    bool dot_merged = 1;        //! 前一个字符已带小数点（或还没有字符）
+
+    for (; *str != '\0'; str++)
+    {
+        c = (uint8_t)*str;
+
+        if ((c == '.') && !dot_merged)
+        {
+            buf[size - n] = SEG_CODE_DP(buf[size - n]);        //! 前一个字符位于 buf[size-n]
+            dot_merged = 1;
+        }
+        else if (n < size)
+        {
+            buf[size - 1 - n] = ((c >= 0x20) && (c < 0x80)) ? SEG_GLYPH_BYTE(segment_glyph_table[c - 0x20]) : SEG_BLANK_BYTE;
+            n++;
+            dot_merged = (c == '.');
+        }
+        else
+        {
+            break;
+        }
+    }
 
+    return n;
 }
 
 /**
- * @brief 动态扫描刷新函数（需周期调用）
- * @note 可以放在主循环中循环调用
+ * @brief 等待中断完成窗口切换（seg_pending 被清除）
+ * @note Timer0 中断未开启或 Timer0 未运行时（如开总中断前）不会到达帧边界，直接在此切换
  * @param None
  * @return None
  */
-void segment_scan_task()
+static void segment_wait_swap(void)
+{
+    while (seg_pending != SEG_NO_PAGE)
+    {
+        if (!(EA && ET0 && TR0))
+        {
+            seg_window = seg_pending;
+            seg_pending = SEG_NO_PAGE;
+        }
+    }
+}
+
+/**
+ * @brief 找出空闲的一页：既不是前台页（正在显示或等待切换），也不是正在显示的窗口
+ * @note 在 seg_pending 指向前台页之后调用：中断此后只会把窗口切换到前台页，读到的窗口即使随后被切换，
+ *       返回的页也不会再被显示；滚动显示时窗口在滚动缓冲区中，不与任何一页相同
+ * @param None
+ * @return 空闲页
+ */
+static uint8_t idata *segment_free_page(void)
+{
+    uint8_t idata *window = seg_window;         //! 只读取 1 次（1 字节指针，原子操作）
+    uint8_t i;
+
+    for(i=0;i<SEG_PAGE_NUM;i++)
+    {
+        if ((seg_page[i] != seg_front) && (seg_page[i] != window))
+        {
+            break;
+        }
+    }
+
+    return seg_page[i];
+}
+
+/**
+ * @brief 准备写入后台页
+ * @details 后台页不会被中断读取，不需要等待；
+ *          提交后的第 1 次写入前把前台页复制到后台页，只改写部分位时其余位保持不变
+ * @param None
+ * @return None
+ */
+static void segment_begin_write(void)
+{
+    uint8_t i;
+
+    if (seg_back_stale)
+    {
+        seg_back_stale = 0;
+        for(i=0;i<SEG_DIGIT_COUNT;i++)      seg_buffer[i] = seg_front[i];
+    }
+}
+
+/**
+ * @brief 每帧结束时调用（在 Timer0 中断中）
+ * @note 闪烁属性计数并切换相位；有等待切换的窗口时切换窗口，否则滚动显示时每 SEG_SCROLL_FRAMES 帧把窗口向低地址移动 1 位，
+ *       文本完全移出后回到开始位置
+ * @param None
+ * @return None
+ */
+static void segment_frame_end(void)
+{
+    #if (SEG_BLINK_MS > 0)
+        if (--seg_blink_count == 0)
+        {
+            seg_blink_count = (uint8_t)SEG_BLINK_FRAMES;
+            seg_attr_phase ^= SEG_ATTR_BLINK | SEG_ATTR_FLASH_DP;       //! 切换相位
+        }
+    #endif
+
+    if (seg_pending != SEG_NO_PAGE)
+    {
+        seg_window = seg_pending;
+        seg_pending = SEG_NO_PAGE;
+        return;
+    }
+
+    #if (SEG_SCROLL_TEXT_MAX > 0)
+        if (seg_scrolling && (--seg_scroll_count == 0))
+        {
+            seg_scroll_count = (uint8_t)SEG_SCROLL_FRAMES;
+
+            if (seg_window == seg_scroll_end)
+            {
+                seg_window = seg_scroll_buffer + SEG_SCROLL_TEXT_MAX + SEG_DIGIT_COUNT;
+            }
+            else
+            {
+                seg_window --;
+            }
+        }
+    #endif
+}
+
+/**
+ * @brief 动态扫描刷新函数，刷新 1 位或 1 个亮度分段
+ * @note 由 Timer0 中断调用，不要在主循环中调用；
+ *       亮度调制时每位的时隙按 1:2:4:... 分段，第 1 段消隐并切换位选，之后各段只按亮度位改写段码端口
+ * @param None
+ * @return 到下次中断的 Timer0 计数值
+ */
+static uint16_t segment_scan(void)
 {
-    segment_noselect_digit();           //! 关闭位选信号
-    segment_write_data(seg_buffer[seg_scan_index]);           //! 输出要显示的段码数据
-    segment_select_digit(seg_scan_index);           //! 选择显示的数码管位
+    #if (SEG_BRIGHTNESS_BITS > 0)
 
-    seg_scan_index ++;           //! 切换到下一扫描位
+        uint16_t period = seg_bcm_period;
+        uint8_t seg;
 
-    //! 扫描位归0
-    if(seg_scan_index>= SEG_DIGIT_COUNT)    seg_scan_index = 0;
-}
\ No newline at end of file
+        if (seg_bcm_mask == 0x01)
+        {
+            seg_scan_code = seg_window[seg_scan_index];
+            SEG_APPLY_ATTR(seg_scan_code, seg_scan_index);
+        }
+
+        seg = (seg_level[seg_scan_index] & seg_bcm_mask) ? seg_scan_code : SEG_BLANK_BYTE;
+
+        if (seg_bcm_mask == 0x01)
+        {
+            SEGMENT_REFRESH(seg, seg_scan_index);       //! 第 1 段：消隐，输出段码，选择数码管位
+        }
+        else
+        {
+            SEGMENT_OUTPUT(seg, seg_scan_index);        //! 后续各段：位选不变，只改写段码
+        }
+
+        //! 下一段时长加倍，最后一段结束后切换到下一扫描位
+        seg_bcm_mask <<= 1;
+        seg_bcm_period <<= 1;
+        if (seg_bcm_mask > SEG_BRIGHTNESS_MAX)
+        {
+            seg_bcm_mask = 0x01;
+            seg_bcm_period = SEG_SLICE_COUNT;
+
+            if(++seg_scan_index >= SEG_DIGIT_COUNT)
+            {
+                seg_scan_index = 0;
+                segment_frame_end();
+            }
+        }
+
+        return period;
+
+    #else
+
+        uint8_t seg = seg_window[seg_scan_index];
+
+        SEG_APPLY_ATTR(seg, seg_scan_index);
+        SEGMENT_REFRESH(seg, seg_scan_index);      //! 消隐，输出段码，选择数码管位
+
+        //! 切换到下一扫描位，扫描位归0
+        if(++seg_scan_index >= SEG_DIGIT_COUNT)
+        {
+            seg_scan_index = 0;
+            segment_frame_end();
+        }
+
+        return SEG_SLICE_COUNT;
+
+    #endif
+}
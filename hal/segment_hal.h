@@ -2,21 +2,85 @@
  * @file    segment_hal.C
  * @brief   数码管显示模块的 hal 驱动头文件
  * @details 本文件用于数码管显示模块的硬件抽象层驱动
- * @version 1.0.0
+ *  - 显示缓冲区保存最终的段码端口字节（小数点已合成），编码在 segment_set_*() 中完成，
+ *    刷新时不再查表，每位只有 3 次端口写入和 1 次下标递增
+ *  - 动态扫描在 Timer0 中断中进行（segment_init_hal() 中注册），主循环阻塞时显示不闪烁、不冻结；
+ *    刷新频率与消隐时间在 segment_configuration.h 中配置，每次中断的耗时可由 timer0_get_isr_cycles() 读取
+ *  - 亮度用二进制码调制实现，每位每帧 SEG_BRIGHTNESS_BITS 次中断（每多 1 位亮度多 1 次中断），
+ *    亮度降低时点亮时间按比例缩短，功耗随之下降
+ *  - 小数用定点数显示（segment_set_fixed_number()），不使用浮点运算；
+ *    segment_set_float_number() 仅在 SEG_FLOAT_SUPPORT 为 1 时编译
+ *  - 字符串按 ASCII 字形表编码；滚动显示只编码 1 次，之后由中断在帧边界移动显示窗口（1 字节指针）
+ *  - 三缓冲：segment_set_*() 与 clear_seg_buffer() 只写入后台页，调用 segment_present() 后才显示；
+ *    中断在帧边界切换 1 字节的页指针，不关闭中断，也不会显示写了一半的数字；
+ *    写入与提交都不等待帧边界（1 帧内多次提交只显示最后 1 次），只有开始滚动显示时最长等待 1 帧
+ *  - 区域：segment_region_*() 只格式化区域内的位，区域外的位保持不变，多个字段可由不同任务各自更新；
+ *    提交后的第 1 次写入从前台页复制，各任务写入各自的区域后调用 segment_present() 即可
+ *  - 属性：每位可设置闪烁（SEG_ATTR_BLINK）与小数点闪烁（SEG_ATTR_FLASH_DP），由中断按帧计数切换相位（每帧 1 次计数），
+ *    主循环不需要定时改写显示内容；属性属于数码管位，立即生效，不随 segment_present() 交换
+ *
+ * @code{.c}
+ * //! 8 位数码管：低 4 位显示数值，最高 2 位显示代码
+ * static seg_region_t code region_value = {0, 4, SEG_ALIGN_RIGHT, SEG_PAD_BLANK};
+ * static seg_region_t code region_code  = {6, 2, SEG_ALIGN_RIGHT, SEG_PAD_ZERO};
+ *
+ * segment_region_set_fixed(&region_value, temperature, 1);
+ * segment_region_set_int(&region_code, 7);             //! 显示 "07"
+ * segment_present();
+ * @endcode
+ * @version 1.9.0
  * @author  ForeverMySunyu
- * @date    2025-12-22
+ * @date    2026-10-18
  */
 
 #ifndef _SEGMENT_HAL_H_
 #define _SEGMENT_HAL_H_
 
 #include <stdint.h>
+#include "../config/segment_configuration.h"
+
+#define SEG_DIGIT_ALL       0xff        //! segment_set_brightness() 的位号参数：设置全局亮度
+
+/** @brief 区域内的对齐方式 */
+#define SEG_ALIGN_RIGHT     0           /**< 右对齐（靠近最低位），其余高位为填充 */
+#define SEG_ALIGN_LEFT      1           /**< 左对齐（靠近最高位），其余低位全灭 */
+
+/** @brief 数值的填充方式 */
+#define SEG_PAD_BLANK       0           /**< 填充全灭 */
+#define SEG_PAD_ZERO        1           /**< 填充 '0'（负号在区域的最高位，字符串不补零） */
+
+/** @brief 每位的属性（可按位或组合） */
+#define SEG_ATTR_NONE       0x00        /**< 正常显示 */
+#define SEG_ATTR_BLINK      0x01        /**< 闪烁：熄灭相位时该位全灭 */
+#define SEG_ATTR_FLASH_DP   0x02        /**< 小数点闪烁：熄灭相位时取反该位的小数点（可用作编辑光标） */
+
+/** @brief 显示区域（连续的若干位） */
+typedef struct
+{
+    uint8_t offset;         //! 区域最低位的位号（0 为整个显示的最低位）
+    uint8_t width;          //! 区域位数（offset + width 不超过 SEG_DIGIT_COUNT）
+    uint8_t align;          //! 对齐方式（SEG_ALIGN_RIGHT / SEG_ALIGN_LEFT）
+    uint8_t pad;            //! 填充方式（SEG_PAD_BLANK / SEG_PAD_ZERO）
+} seg_region_t;
 
 /* ================== API 函数声明区域 ================== */
-void segment_init_hal(void);        //! 数码管显示初始化函数
-void clear_seg_buffer(void);        //!
+void segment_init_hal(void);        //! 数码管显示初始化函数（启动 Timer0 动态扫描）
+void segment_present(void);         //! 提交后台页，在下一帧边界显示
+void clear_seg_buffer(void);        //! 清空数码管显示缓冲区（全灭）
+void segment_set_brightness(uint8_t digit, uint8_t level);      //! 设置每位亮度或全局亮度
+void segment_set_attr(uint8_t digit, uint8_t attr);             //! 设置每位属性（闪烁、小数点闪烁）
 void segment_set_int_number(int32_t value);      //! 设置要显示的**整数**数值
-void segment_set_float_number(float value, uint8_t decimal_places);         //! 设置要显示的**浮点数**数值
-void segment_scan_task(void);       //! 动态扫描刷新函数（需周期调用）
+void segment_set_fixed_number(int32_t value, uint8_t decimal_places);       //! 设置要显示的**定点数**数值（value / 10^decimal_places）
+void segment_set_string(const char *str);       //! 设置要显示的**字符串**（左对齐）
+void segment_scroll_string(const char *str);    //! 循环滚动显示字符串（从右向左移动）
+void segment_region_clear(const seg_region_t *region);         //! 清空区域（全灭）
+void segment_region_set_int(const seg_region_t *region, int32_t value);        //! 在区域中显示**整数**数值
+void segment_region_set_fixed(const seg_region_t *region, int32_t value, uint8_t decimal_places);      //! 在区域中显示**定点数**数值
+void segment_region_set_string(const seg_region_t *region, const char *str);   //! 在区域中显示**字符串**
+void segment_region_set_attr(const seg_region_t *region, uint8_t attr);       //! 设置区域内各位的属性
+
+#if SEG_FLOAT_SUPPORT
+    void segment_set_float_number(float value, uint8_t decimal_places);     //! 设置要显示的**浮点数**数值（链接浮点运算库）
+#endif
 
-#endif      /* _SEGMENT_HAL_H_ */
\ No newline at end of file
+#endif      /* _SEGMENT_HAL_H_ */
@@ -0,0 +1,184 @@
+/**
+ * @file    spi_hal.c
+ * @brief   SPI 软件模拟（主机）hal 实现
+ * @version 1.0.0
+ * @author  ForeverMySunyu
+ * @date    2026-10-18
+ *
+ * @details
+ *  - 字节在 bdata 变量 spi_shift 中收发，最高位先发送（MSB first）
+ *  - 收发时第 n 位先送出再被采样值覆盖，同一变量既是发送移位寄存器也是接收移位寄存器
+ *  - 边沿宏：前沿（leading edge）SCLK 由空闲电平翻转到非空闲电平，后沿（trailing edge）恢复空闲电平
+ *      CPHA = 0：MOSI 在前沿之前准备好，前沿采样
+ *      CPHA = 1：MOSI 在前沿之后改变，后沿采样
+ */
+
+#include <stddef.h>
+#include "../config/spi_configuration.h"
+#include "../bsp/spi_bsp.h"
+#include "spi_hal.h"
+
+/*==================== 移位寄存器（可位寻址） ====================*/
+
+uint8_t bdata spi_shift;        //! 收发移位寄存器
+
+sbit    SPI_SHIFT_7     =   spi_shift^7;
+sbit    SPI_SHIFT_6     =   spi_shift^6;
+sbit    SPI_SHIFT_5     =   spi_shift^5;
+sbit    SPI_SHIFT_4     =   spi_shift^4;
+sbit    SPI_SHIFT_3     =   spi_shift^3;
+sbit    SPI_SHIFT_2     =   spi_shift^2;
+sbit    SPI_SHIFT_1     =   spi_shift^1;
+sbit    SPI_SHIFT_0     =   spi_shift^0;
+
+/*==================== 位时序宏（按 SPI 模式在编译期选定） ====================*/
+
+#define SPI_LEAD_EDGE()     SCLK_Set(!SPI_CPOL)     //! 前沿
+#define SPI_TRAIL_EDGE()    SCLK_Set(SPI_CPOL)      //! 后沿
+
+#if SPI_CPHA == 0
+
+    //! 收发 1 位：送出 b，采样后写回 b
+    #define SPI_XFER_BIT(b)     { MOSI_Set(b); SPI_LEAD_EDGE(); (b) = MISO_Read(); SPI_TRAIL_EDGE(); }
+    //! 只发送 1 位
+    #define SPI_WRITE_BIT(b)    { MOSI_Set(b); SPI_LEAD_EDGE(); SPI_TRAIL_EDGE(); }
+    //! 只接收 1 位
+    #define SPI_READ_BIT(b)     { SPI_LEAD_EDGE(); (b) = MISO_Read(); SPI_TRAIL_EDGE(); }
+
+#else
+
+    #define SPI_XFER_BIT(b)     { SPI_LEAD_EDGE(); MOSI_Set(b); SPI_TRAIL_EDGE(); (b) = MISO_Read(); }
+    #define SPI_WRITE_BIT(b)    { SPI_LEAD_EDGE(); MOSI_Set(b); SPI_TRAIL_EDGE(); }
+    #define SPI_READ_BIT(b)     { SPI_LEAD_EDGE(); SPI_TRAIL_EDGE(); (b) = MISO_Read(); }
+
+#endif
+
+/*==================== 字节宏（8 位完全展开，操作 spi_shift） ====================*/
+
+#define SPI_XFER_BYTE()                                                         \
+    SPI_XFER_BIT(SPI_SHIFT_7) SPI_XFER_BIT(SPI_SHIFT_6)                         \
+    SPI_XFER_BIT(SPI_SHIFT_5) SPI_XFER_BIT(SPI_SHIFT_4)                         \
+    SPI_XFER_BIT(SPI_SHIFT_3) SPI_XFER_BIT(SPI_SHIFT_2)                         \
+    SPI_XFER_BIT(SPI_SHIFT_1) SPI_XFER_BIT(SPI_SHIFT_0)
+
+#define SPI_WRITE_BYTE()                                                        \
+    SPI_WRITE_BIT(SPI_SHIFT_7) SPI_WRITE_BIT(SPI_SHIFT_6)                       \
+    SPI_WRITE_BIT(SPI_SHIFT_5) SPI_WRITE_BIT(SPI_SHIFT_4)                       \
+    SPI_WRITE_BIT(SPI_SHIFT_3) SPI_WRITE_BIT(SPI_SHIFT_2)                       \
+    SPI_WRITE_BIT(SPI_SHIFT_1) SPI_WRITE_BIT(SPI_SHIFT_0)
+
+#define SPI_READ_BYTE()                                                         \
+    SPI_READ_BIT(SPI_SHIFT_7) SPI_READ_BIT(SPI_SHIFT_6)                         \
+    SPI_READ_BIT(SPI_SHIFT_5) SPI_READ_BIT(SPI_SHIFT_4)                         \
+    SPI_READ_BIT(SPI_SHIFT_3) SPI_READ_BIT(SPI_SHIFT_2)                         \
+    SPI_READ_BIT(SPI_SHIFT_1) SPI_READ_BIT(SPI_SHIFT_0)
+
+/*==================== API 函数定义区域 ====================*/
+
+/**
+ * @brief SPI 初始化函数
+ * @param None
+ * @return None
+ */
+void SPI_Init_hal(void)
+{
+    SPI_Init_bsp();
+}
+
+/**
+ * @brief 收发 1 个字节（全双工）
+ * @param byte 要发送的字节
+ * @return 同时接收到的字节
+ */
+uint8_t SPI_TransferByte(uint8_t byte)
+{
+    spi_shift = byte;
+    SPI_XFER_BYTE()
+
+    return spi_shift;
+}
+
+/**
+ * @brief 只发送 1 个字节（不采样 MISO）
+ * @param byte 要发送的字节
+ * @return None
+ */
+void SPI_WriteByte(uint8_t byte)
+{
+    spi_shift = byte;
+    SPI_WRITE_BYTE()
+}
+
+/**
+ * @brief 只接收 1 个字节（MOSI 保持高电平，相当于发送 0xFF）
+ * @param None
+ * @return 接收到的字节
+ */
+uint8_t SPI_ReadByte(void)
+{
+    MOSI_Set(1);
+    SPI_READ_BYTE()
+
+    return spi_shift;
+}
+
+/**
+ * @brief 连续发送 length 个字节
+ * @param buf 指向要发送的数据
+ * @param length 字节数
+ * @return None
+ */
+void SPI_Write(const uint8_t *buf, uint16_t length)
+{
+    while (length)
+    {
+        spi_shift = *buf;
+        SPI_WRITE_BYTE()
+
+        buf ++;
+        length --;
+    }
+}
+
+/**
+ * @brief 连续接收 length 个字节（MOSI 保持高电平）
+ * @param buf 指向接收缓冲区
+ * @param length 字节数
+ * @return None
+ */
+void SPI_Read(uint8_t *buf, uint16_t length)
+{
+    MOSI_Set(1);
+
+    while (length)
+    {
+        SPI_READ_BYTE()
+        *buf = spi_shift;
+
+        buf ++;
+        length --;
+    }
+}
+
+/**
+ * @brief 连续收发 length 个字节（全双工）
+ * @param tx_buf 指向要发送的数据，为 NULL 时发送 SPI_DUMMY_BYTE
+ * @param rx_buf 指向接收缓冲区，为 NULL 时丢弃接收数据
+ * @param length 字节数
+ * @return None
+ */
+void SPI_Transfer(const uint8_t *tx_buf, uint8_t *rx_buf, uint16_t length)
+{
+    while (length)
+    {
+        spi_shift = (tx_buf != NULL) ? *tx_buf++ : SPI_DUMMY_BYTE;
+        SPI_XFER_BYTE()
+
+        if (rx_buf != NULL)
+        {
+            *rx_buf++ = spi_shift;
+        }
+
+        length --;
+    }
+}
@@ -0,0 +1,100 @@
+/**
+ * @file    spi_hal.h
+ * @brief   SPI 软件模拟（主机）hal 接口
+ * @version 1.0.1
+ * @author  ForeverMySunyu
+ * @date    2026-10-18
+ *
+ * @details
+ *  - SPI 模式在 spi_configuration.h 中编译期选择，字节收发代码按模式完全展开（8 位无循环、无分支）
+ *  - 每个数据位经 bdata 移位变量的位寻址完成，1 位只需 MOV C,bit / MOV bit,C 与两次 SCLK 翻转
+ *  - 只写 / 只读 / 收发各有独立的字节例程，只写不采样 MISO，只读不改变 MOSI
+ *  - 连续传输（SPI_Write / SPI_Read / SPI_Transfer）在循环内直接展开字节代码，不调用单字节函数
+ *
+ * @note 速率估算（按 Keil C51 典型指令时序手工计算的估算值，非实测）：
+ *       - 每位：收发 8 个机器周期，只写 / 只读 5 个机器周期
+ *       - SCLK 峰值为字节内相邻两位之间的速率（晶振 / 机器周期 / 每位周期数），不含字节间开销
+ *       - 连续传输每字节（含指针与计数开销）：只写 / 只读约 70 个机器周期，收发约 110 个机器周期
+ *
+ * |  晶振 (MHz)  | 模式 | SCLK 峰值：只写 / 只读 (kHz) | SCLK 峰值：收发 (kHz) | SPI_Write / SPI_Read (B/s) | SPI_Transfer (B/s) |
+ * | :----------: | :--: | :--------------------------: | :-------------------: | :------------------------: | :----------------: |
+ * |   11.0592    | 12T  |             184              |          115          |           13166            |        8378        |
+ * |   12.000     | 12T  |             200              |          125          |           14286            |        9091        |
+ * |   22.1184    | 12T  |             369              |          230          |           26331            |       16756        |
+ * |   24.000     | 12T  |             400              |          250          |           28571            |       18182        |
+ * |   11.0592    |  6T  |             369              |          230          |           26331            |       16756        |
+ * |   22.1184    |  6T  |             737              |          461          |           52663            |       33513        |
+ *
+ *       更换编译器版本或优化等级后，应以 Keil 软件仿真（Debug → Start Session，观察 states / sec）
+ *       对 SPI_Write() 计时复核上表
+ */
+
+#ifndef _SPI_HAL_H_
+#define _SPI_HAL_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "../config/spi_configuration.h"
+#include "../bsp/spi_bsp.h"
+
+/*==================== 片选操作接口 ====================*/
+
+#define SPI_Select()        CS_Set(0)       //! 选中从机（CS 拉低）
+#define SPI_Deselect()      CS_Set(1)       //! 释放从机（CS 拉高）
+
+/*==================== API 函数声明区域 ====================*/
+
+/**
+ * @brief SPI 初始化函数
+ * @param None
+ * @return None
+ */
+void SPI_Init_hal(void);
+
+/**
+ * @brief 收发 1 个字节（全双工）
+ * @param byte 要发送的字节
+ * @return 同时接收到的字节
+ */
+uint8_t SPI_TransferByte(uint8_t byte);
+
+/**
+ * @brief 只发送 1 个字节（不采样 MISO）
+ * @param byte 要发送的字节
+ * @return None
+ */
+void SPI_WriteByte(uint8_t byte);
+
+/**
+ * @brief 只接收 1 个字节（MOSI 保持高电平，相当于发送 0xFF）
+ * @param None
+ * @return 接收到的字节
+ */
+uint8_t SPI_ReadByte(void);
+
+/**
+ * @brief 连续发送 length 个字节
+ * @param buf 指向要发送的数据
+ * @param length 字节数
+ * @return None
+ */
+void SPI_Write(const uint8_t *buf, uint16_t length);
+
+/**
+ * @brief 连续接收 length 个字节（MOSI 保持高电平）
+ * @param buf 指向接收缓冲区
+ * @param length 字节数
+ * @return None
+ */
+void SPI_Read(uint8_t *buf, uint16_t length);
+
+/**
+ * @brief 连续收发 length 个字节（全双工）
+ * @param tx_buf 指向要发送的数据，为 NULL 时发送 SPI_DUMMY_BYTE
+ * @param rx_buf 指向接收缓冲区，为 NULL 时丢弃接收数据
+ * @param length 字节数
+ * @return None
+ */
+void SPI_Transfer(const uint8_t *tx_buf, uint8_t *rx_buf, uint16_t length);
+
+#endif  /* _SPI_HAL_H_ */
@@ -0,0 +1,336 @@
+/**
+ * @file    eeprom_async_test.c
+ * @brief   EEPROM 异步写入队列主机仿真测试
+ * @version 1.2.0
+ * @author  ForeverMySunyu
+ * @date    2026-10-18
+ *
+ * @details
+ *  - 在 PC 上用 gcc 编译（见 test/Makefile），EEPROM 为 bsp/iic_sim_bsp.c 中的 AT24C02 模型（写周期 5 ms）
+ *  - 软件定时器由本文件提供桩函数（只有测试置位 stub_timer_expired 时到期，节拍计数由测试推进），
+ *    EEPROM_Async_Task() 在循环中直接调用，每次调用前推进 1 个节拍
+ *  - 重点检查回调中再次提交请求（发送失败后重试、完成后提交下一请求）时队列状态保持一致：
+ *    每个请求只发出 1 次，只有真正写入的数据才报告 EEPROM_OK
+ *  - SDA 被拉低（总线故障）时 ACK 轮询与异步队列必须报告失败，不能把未确认的写入报告为完成
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "../hal/iic_hal.h"
+#include "../hal/eeprom_hal.h"
+#include "../hal/eeprom_async_hal.h"
+#include "../core/soft_timer.h"
+#include "../bsp/iic_sim_bsp.h"
+
+#define TASK_LOOPS_MAX      10000       //! 等待队列清空时最多调用 EEPROM_Async_Task() 的次数
+#define RETRY_MAX           100         //! 回调中重试的次数上限
+
+/*==================== 测试框架 ====================*/
+
+static uint16_t test_failed = 0;
+
+#define CHECK(cond)                                                                 \
+    do {                                                                            \
+        if (!(cond))                                                                \
+        {                                                                           \
+            printf("  FAIL %s:%d: %s\n", __FILE__, __LINE__, #cond);                \
+            test_failed ++;                                                         \
+        }                                                                           \
+    } while (0)
+
+/*==================== 软件定时器桩函数 ====================*/
+
+static bool stub_timer_expired = 0;        //! soft_timer_expired() 的返回值
+static uint16_t stub_ticks = 0;            //! soft_timer_ticks() 的返回值
+
+void soft_timer_init(void)                          {}
+void soft_timer_start(uint8_t id, uint16_t ms)      { (void)id; (void)ms; }
+void soft_timer_stop(uint8_t id)                    { (void)id; }
+bool soft_timer_expired(uint8_t id)                 { (void)id; return stub_timer_expired; }
+bool soft_timer_running(uint8_t id)                 { (void)id; return 0; }
+uint16_t soft_timer_ticks(void)                     { return stub_ticks; }
+
+/*==================== 回调记录 ====================*/
+
+static uint8_t data_a[8] = {0xA0, 0xA1, 0xA2, 0xA3, 0xA4, 0xA5, 0xA6, 0xA7};
+static uint8_t data_b[8] = {0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7};
+
+static uint16_t result_ok = 0;          //! 报告 EEPROM_OK 的次数
+static uint16_t result_error = 0;       //! 报告错误的次数
+static uint16_t retries = 0;            //! 回调中重试的次数
+static EEPROM_Error_T last_result;      //! 最近一次回调的结果
+
+/**
+ * @brief 失败时重试的回调：在回调中再次提交同一请求
+ */
+static void retry_callback(EEPROM_Error_T result)
+{
+    if (result == EEPROM_OK)
+    {
+        result_ok ++;
+        return;
+    }
+
+    result_error ++;
+
+    if (retries < RETRY_MAX)
+    {
+        retries ++;
+        CHECK(EEPROM_Async_Write(16, data_a, sizeof(data_a), retry_callback) == EEPROM_OK);
+    }
+}
+
+/**
+ * @brief 完成后提交下一请求的回调
+ */
+static void chain_callback(EEPROM_Error_T result)
+{
+    if (result == EEPROM_OK)
+    {
+        result_ok ++;
+        CHECK(EEPROM_Async_Write(32, data_b, sizeof(data_b), NULL) == EEPROM_OK);
+    }
+    else
+    {
+        result_error ++;
+    }
+}
+
+/**
+ * @brief 记录结果的回调
+ */
+static void record_callback(EEPROM_Error_T result)
+{
+    last_result = result;
+
+    if (result == EEPROM_OK)    result_ok ++;
+    else                        result_error ++;
+}
+
+/**
+ * @brief 调用 EEPROM_Async_Task() 直到队列清空
+ * @return 1-队列已清空，0-超过 TASK_LOOPS_MAX 次
+ */
+static bool run_until_idle(void)
+{
+    uint16_t i;
+
+    for (i = 0; (i < TASK_LOOPS_MAX) && EEPROM_Async_Busy(); i++)
+    {
+        stub_ticks ++;
+        EEPROM_Async_Task();
+    }
+
+    return !EEPROM_Async_Busy();
+}
+
+/*==================== 测试用例 ====================*/
+
+/**
+ * @brief 器件处于写周期时提交请求：发送失败，回调中重试直到发出
+ */
+static void test_retry_after_failed_send(void)
+{
+    uint8_t busy_page[8] = {0};
+    uint32_t cycles;
+    int8_t dev;
+
+    printf("retry in callback after failed send\n");
+
+    iic_sim_reset();
+    dev = iic_sim_attach_at24(0, 0xA0, 256, 8, 1, 5000, 0);
+    CHECK(EEPROM_Init_hal() == EEPROM_OK);
+    EEPROM_Async_Init();
+    result_ok = 0;
+    result_error = 0;
+    retries = 0;
+
+    /* 同步发出 1 页（不等待写周期），器件在 5 ms 内对地址回 NACK */
+    CHECK(EEPROM_PageSend(0, 0, busy_page, sizeof(busy_page)) == EEPROM_OK);
+    cycles = iic_sim_at24_write_cycles(dev);
+
+    CHECK(EEPROM_Async_Write(16, data_a, sizeof(data_a), retry_callback) == EEPROM_OK);
+
+    /* 返回时：若干次发送失败并在回调中重试，最后 1 次发出，正在等待写周期 */
+    printf("  retries before the page was sent: %u\n", retries);
+    CHECK(retries > 0);
+    CHECK(retries < RETRY_MAX);
+    CHECK(result_error == retries);
+    CHECK(result_ok == 0);
+    CHECK(EEPROM_Async_Busy());
+
+    CHECK(run_until_idle());
+    CHECK(result_ok == 1);
+    CHECK(result_error == retries);
+    CHECK(iic_sim_at24_write_cycles(dev) == cycles + 1);        //! 该请求只写入 1 次
+    CHECK(memcmp(iic_sim_at24_memory(dev) + 16, data_a, sizeof(data_a)) == 0);
+
+    /* 队列状态一致：之后的请求立即发出并真正写入 */
+    CHECK(EEPROM_Async_Write(24, data_b, sizeof(data_b), NULL) == EEPROM_OK);
+    CHECK(iic_sim_at24_write_cycles(dev) == cycles + 2);
+    CHECK(run_until_idle());
+    CHECK(memcmp(iic_sim_at24_memory(dev) + 24, data_b, sizeof(data_b)) == 0);
+
+    CHECK(iic_sim_violations(0) == 0);
+}
+
+/**
+ * @brief 完成回调中提交下一请求
+ */
+static void test_chain_in_callback(void)
+{
+    int8_t dev;
+
+    printf("submit next write from completion callback\n");
+
+    iic_sim_reset();
+    dev = iic_sim_attach_at24(0, 0xA0, 256, 8, 1, 5000, 0);
+    CHECK(EEPROM_Init_hal() == EEPROM_OK);
+    EEPROM_Async_Init();
+    result_ok = 0;
+    result_error = 0;
+
+    CHECK(EEPROM_Async_Write(20, data_a, sizeof(data_a), chain_callback) == EEPROM_OK);      //! 跨页：2 页
+    CHECK(run_until_idle());
+
+    CHECK(result_ok == 1);
+    CHECK(result_error == 0);
+    CHECK(iic_sim_at24_write_cycles(dev) == 3);
+    CHECK(memcmp(iic_sim_at24_memory(dev) + 20, data_a, sizeof(data_a)) == 0);
+    CHECK(memcmp(iic_sim_at24_memory(dev) + 32, data_b, sizeof(data_b)) == 0);
+
+    CHECK(iic_sim_violations(0) == 0);
+}
+
+/**
+ * @brief SDA 被拉低：ACK 轮询与异步队列报告失败，不把未确认的写入报告为完成
+ */
+static void test_stuck_sda(void)
+{
+    uint32_t clocks;
+    uint16_t i;
+
+    printf("stuck SDA fails polling and the async queue\n");
+
+    iic_sim_reset();
+    iic_sim_attach_at24(0, 0xA0, 256, 8, 1, 5000, 0);
+    CHECK(EEPROM_Init_hal() == EEPROM_OK);
+    EEPROM_Async_Init();
+    result_ok = 0;
+    result_error = 0;
+    stub_timer_expired = 0;
+
+    /* 页已发出、正在等待写周期时 SDA 被永久拉低 */
+    CHECK(EEPROM_Async_Write(40, data_a, sizeof(data_a), record_callback) == EEPROM_OK);
+    CHECK(EEPROM_Async_Busy());
+    iic_sim_inject_sda_stuck(0, 0xFFFF);
+
+    CHECK(EEPROM_AckProbe() == EEPROM_ERR_IIC);
+    CHECK(EEPROM_AckPolling() == EEPROM_ERR_IIC);
+
+    /* 总线已进入退避：探测不产生时钟 */
+    clocks = iic_sim_scl_clocks(0);
+    CHECK(EEPROM_AckProbe() == EEPROM_ERR_IIC);
+    CHECK(iic_sim_scl_clocks(0) == clocks);
+
+    /* 超时前：请求保持未完成 */
+    for (i = 0; i < 10; i++)
+    {
+        stub_ticks ++;
+        EEPROM_Async_Task();
+    }
+    CHECK(EEPROM_Async_Busy());
+    CHECK(result_ok == 0);
+
+    /* 超时后：请求以总线错误结束 */
+    stub_ticks ++;
+    stub_timer_expired = 1;
+    EEPROM_Async_Task();
+    stub_timer_expired = 0;
+    CHECK(!EEPROM_Async_Busy());
+    CHECK(result_ok == 0);
+    CHECK(result_error == 1);
+    CHECK(last_result == EEPROM_ERR_IIC);
+
+    /* 总线故障时提交：页无法发出，请求立即失败 */
+    CHECK(EEPROM_Async_Write(48, data_b, sizeof(data_b), record_callback) == EEPROM_OK);
+    CHECK(!EEPROM_Async_Busy());
+    CHECK(result_ok == 0);
+    CHECK(result_error == 2);
+    CHECK(last_result != EEPROM_OK);
+
+    /* Flush 中的 ACK 轮询失败（先结束退避，使第 1 页能够发出） */
+    iic_sim_inject_sda_stuck(0, 0);
+    IIC_Clear_Stats(0);
+    CHECK(EEPROM_AckPolling() == EEPROM_OK);        //! 等待之前发出的页写周期结束
+    CHECK(EEPROM_Async_Write(56, data_b, sizeof(data_b), record_callback) == EEPROM_OK);
+    CHECK(EEPROM_Async_Busy());         //! 第 1 页已发出
+    iic_sim_inject_sda_stuck(0, 0xFFFF);
+    EEPROM_Async_Flush();
+    CHECK(!EEPROM_Async_Busy());
+    CHECK(result_ok == 0);
+    CHECK(last_result == EEPROM_ERR_IIC);
+
+    iic_sim_inject_sda_stuck(0, 0);
+}
+
+/**
+ * @brief 写周期中每个节拍最多 1 次 ACK 探测
+ */
+static void test_probe_rate(void)
+{
+    uint32_t clocks;
+    uint16_t i;
+    int8_t dev;
+
+    printf("at most one ACK probe per tick\n");
+
+    iic_sim_reset();
+    dev = iic_sim_attach_at24(0, 0xA0, 256, 8, 1, 5000, 0);
+    IIC_Clear_Stats(0);                 //! 结束上一用例留下的退避
+    CHECK(EEPROM_Init_hal() == EEPROM_OK);
+    EEPROM_Async_Init();
+    result_ok = 0;
+    result_error = 0;
+
+    CHECK(EEPROM_Async_Write(64, data_a, sizeof(data_a), record_callback) == EEPROM_OK);
+
+    /* 发出页的节拍内：不探测，不产生时钟 */
+    clocks = iic_sim_scl_clocks(0);
+    for (i = 0; i < 100; i++)
+    {
+        EEPROM_Async_Task();
+    }
+    CHECK(iic_sim_scl_clocks(0) == clocks);
+
+    /* 下一节拍：只探测 1 次（START + 地址 + STOP，10 个时钟） */
+    stub_ticks ++;
+    for (i = 0; i < 100; i++)
+    {
+        EEPROM_Async_Task();
+    }
+    CHECK(iic_sim_scl_clocks(0) - clocks == 10);
+
+    CHECK(run_until_idle());
+    CHECK(result_ok == 1);
+    CHECK(memcmp(iic_sim_at24_memory(dev) + 64, data_a, sizeof(data_a)) == 0);
+}
+
+/*==================== 主函数 ====================*/
+
+int main(void)
+{
+    test_retry_after_failed_send();
+    test_chain_in_callback();
+    test_stuck_sda();
+    test_probe_rate();
+
+    if (test_failed)
+    {
+        printf("eeprom_async_test: %u check(s) failed\n", test_failed);
+        return 1;
+    }
+
+    printf("eeprom_async_test: all checks passed\n");
+    return 0;
+}
@@ -0,0 +1,170 @@
+/**
+ * @file    iic_sim_test.c
+ * @brief   IIC / EEPROM HAL 主机仿真测试（协议正确性 + 总线时间预算）
+ * @version 1.0.0
+ * @author  ForeverMySunyu
+ * @date    2026-10-18
+ *
+ * @details
+ *  - 在 PC 上用 gcc 编译（见 test/Makefile），IIC 引脚操作接到 bsp/iic_sim_bsp.c 的总线模型
+ *  - 总线时间预算 = 当前实测值 + 约 10% 余量，IIC 时序、ACK 轮询或恢复流程变慢时测试失败；
+ *    有意改变时序时（如修改 IIC0_DELAY_10US）同步修改本文件中的预算
+ *  - 总线：IIC0，AT24C02（256 字节，8 字节页，1 字节字地址），写周期 5 ms，无时钟延展
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "../hal/iic_hal.h"
+#include "../hal/eeprom_hal.h"
+#include "../bsp/iic_sim_bsp.h"
+
+/*==================== 总线时间预算（us） ====================*/
+
+#define BUDGET_BYTE_WRITE_US        6800        //! 单字节写入（含 5 ms 写周期的 ACK 轮询）
+#define BUDGET_PAGE_WRITE_US        8600        //! 8 字节页写入（含 ACK 轮询）
+#define BUDGET_PAGE_SEND_US         2700        //! 8 字节页发送（不等待写周期）
+#define BUDGET_BYTE_READ_US         1250        //! 单字节随机读取
+#define BUDGET_SEQ_READ_256_US      83000       //! 256 字节顺序读取
+#define BUDGET_RECOVER_US           1500        //! SDA 被拉低 5 个时钟：第 1 级恢复后 START 成功
+#define BUDGET_BACKOFF_ENTER_US     4000        //! SDA 永久拉低：三级处理后进入退避
+
+/*==================== 测试框架 ====================*/
+
+static uint16_t test_failed = 0;
+
+#define CHECK(cond)                                                                 \
+    do {                                                                            \
+        if (!(cond))                                                                \
+        {                                                                           \
+            printf("  FAIL %s:%d: %s\n", __FILE__, __LINE__, #cond);                \
+            test_failed ++;                                                         \
+        }                                                                           \
+    } while (0)
+
+//! 检查一次操作的结果与总线时间
+#define CHECK_TIMED(name, expr, budget_us)                                          \
+    do {                                                                            \
+        uint32_t elapsed_us;                                                        \
+        iic_sim_mark();                                                             \
+        CHECK((expr) == 0);                                                         \
+        elapsed_us = iic_sim_elapsed_us();                                          \
+        printf("  %-24s %6lu us (budget %6lu us)\n", name,                          \
+               (unsigned long)elapsed_us, (unsigned long)(budget_us));              \
+        CHECK(elapsed_us <= (budget_us));                                           \
+    } while (0)
+
+/*==================== 测试用例 ====================*/
+
+/**
+ * @brief 字节、页与顺序读写的结果与总线时间
+ */
+static void test_eeprom_timing(void)
+{
+    uint8_t wbuf[256];
+    uint8_t rbuf[256];
+    uint8_t byte;
+    uint16_t i;
+    int8_t dev;
+
+    printf("eeprom timing\n");
+
+    iic_sim_reset();
+    dev = iic_sim_attach_at24(0, 0xA0, 256, 8, 1, 5000, 0);
+    CHECK(dev >= 0);
+    CHECK(EEPROM_Init_hal() == EEPROM_OK);
+
+    for (i = 0; i < sizeof(wbuf); i++)     wbuf[i] = (uint8_t)(i * 7 + 1);
+
+    CHECK_TIMED("byte write", EEPROM_ByteWrite(3, 0x5A), BUDGET_BYTE_WRITE_US);
+    CHECK(iic_sim_at24_memory(dev)[3] == 0x5A);
+
+    CHECK_TIMED("page write (8 B)", EEPROM_PageWrite(1, 0, wbuf, 8), BUDGET_PAGE_WRITE_US);
+    CHECK(memcmp(iic_sim_at24_memory(dev) + 8, wbuf, 8) == 0);
+
+    CHECK_TIMED("page send (8 B)", EEPROM_PageSend(2, 0, wbuf, 8), BUDGET_PAGE_SEND_US);
+    CHECK(EEPROM_AckProbe() == EEPROM_ERR_SLAVE_BUSY);       //! 写周期进行中
+    CHECK(EEPROM_AckPolling() == EEPROM_OK);
+    CHECK(memcmp(iic_sim_at24_memory(dev) + 16, wbuf, 8) == 0);
+
+    CHECK_TIMED("byte read", EEPROM_ByteRead(3, &byte), BUDGET_BYTE_READ_US);
+    CHECK(byte == 0x5A);
+
+    memcpy(iic_sim_at24_memory(dev), wbuf, sizeof(wbuf));
+    CHECK_TIMED("sequential read (256 B)", EEPROM_ReadMultiByte(0, rbuf, 256), BUDGET_SEQ_READ_256_US);
+    CHECK(memcmp(rbuf, wbuf, sizeof(wbuf)) == 0);
+
+    CHECK(iic_sim_violations(0) == 0);
+}
+
+/**
+ * @brief 总线恢复与退避：第 1 级恢复成功；永久故障时进入退避，退避期间不访问总线
+ */
+static void test_recovery_backoff(void)
+{
+    iic_stats_t *stats;
+    uint32_t clocks;
+    uint16_t i;
+
+    printf("recovery / backoff\n");
+
+    iic_sim_reset();
+    iic_sim_attach_at24(0, 0xA0, 256, 8, 1, 5000, 0);
+    CHECK(EEPROM_Init_hal() == EEPROM_OK);
+    IIC_Clear_Stats(0);
+    stats = IIC_Get_Stats(0);
+
+    /* SDA 被拉低 5 个时钟：Bus_Recover 的 9 个脉冲即可释放 */
+    iic_sim_inject_sda_stuck(0, 5);
+    CHECK_TIMED("recover (level 1)", IIC_Start(), BUDGET_RECOVER_US);
+    IIC_Stop();
+    CHECK(stats->bus_busy == 1);
+    CHECK(stats->recover == 1);
+    CHECK(stats->slave_reset == 0);
+    CHECK(stats->backoff == 0);
+
+    /* SDA 永久拉低：恢复、复位从机均失败后进入退避 */
+    iic_sim_inject_sda_stuck(0, 0xFFFF);
+    iic_sim_mark();
+    CHECK(IIC_Start() == IIC_ERR_BUSY);
+    printf("  %-24s %6lu us (budget %6lu us)\n", "enter backoff",
+           (unsigned long)iic_sim_elapsed_us(), (unsigned long)BUDGET_BACKOFF_ENTER_US);
+    CHECK(iic_sim_elapsed_us() <= BUDGET_BACKOFF_ENTER_US);
+    CHECK(stats->recover == 2);
+    CHECK(stats->slave_reset == 1);
+    CHECK(stats->backoff == 1);
+
+    /* 退避期间：直接返回总线忙，不产生时钟、不消耗总线时间 */
+    clocks = iic_sim_scl_clocks(0);
+    iic_sim_mark();
+    for (i = 0; i < IIC_BACKOFF_STARTS; i++)
+    {
+        CHECK(IIC_Start() == IIC_ERR_BUSY);
+    }
+    CHECK(iic_sim_elapsed_us() == 0);
+    CHECK(iic_sim_scl_clocks(0) == clocks);
+    CHECK(stats->backoff_skip == IIC_BACKOFF_STARTS);
+
+    /* 故障消失、退避结束后恢复正常 */
+    iic_sim_inject_sda_stuck(0, 0);
+    CHECK(IIC_Start() == IIC_OK);
+    IIC_Stop();
+
+    CHECK(iic_sim_violations(0) == 0);
+}
+
+/*==================== 主函数 ====================*/
+
+int main(void)
+{
+    test_eeprom_timing();
+    test_recovery_backoff();
+
+    if (test_failed)
+    {
+        printf("iic_sim_test: %u check(s) failed\n", test_failed);
+        return 1;
+    }
+
+    printf("iic_sim_test: all checks passed\n");
+    return 0;
+}